@@ -0,0 +1,191 @@
+/**
+ * @file MIPS_Batch.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_BATCH_HPP__
+#define __MIPS_BATCH_HPP__
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <set>
+#include <glob.h>
+#include "MIPS_Options.hpp"
+
+using namespace std;
+
+// runs tasks 0 .. count - 1 on a number of threads. The tasks are dealt out round robin, one
+// deque per worker: a worker takes from the back of its own deque and, once that is empty,
+// steals from the front of the others. Tasks never add tasks, so a worker which finds every
+// deque empty is done.
+struct WORK_STEALING_POOL
+{
+	struct QUEUE
+	{
+		mutex lock;
+		deque<size_t> tasks;
+	};
+
+	template <class TASK>
+	static void run(size_t count, int threads, TASK task)
+	{
+		threads = max(1, (int)min<size_t>(max(threads, 1), count));
+		vector<QUEUE> queues(threads);
+		for (size_t i = 0; i < count; ++i)
+			queues[i % threads].tasks.push_back(i);
+		auto worker = [&](int self)
+		{
+			size_t index;
+			while (take(queues, self, index))
+				task(index);
+		};
+		vector<thread> workers;
+		for (int t = 1; t < threads; ++t)
+			workers.emplace_back(worker, t);
+		worker(0);
+		for (thread &t : workers)
+			t.join();
+	}
+
+	static bool take(vector<QUEUE> &queues, int self, size_t &index)
+	{
+		{
+			lock_guard<mutex> guard(queues[self].lock);
+			if (!queues[self].tasks.empty())
+			{
+				index = queues[self].tasks.back();
+				queues[self].tasks.pop_back();
+				return true;
+			}
+		}
+		for (size_t k = 1; k < queues.size(); ++k)
+		{
+			QUEUE &victim = queues[(self + k) % queues.size()];
+			lock_guard<mutex> guard(victim.lock);
+			if (!victim.tasks.empty())
+			{
+				index = victim.tasks.front();
+				victim.tasks.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+static const char *const EXIT_CODE_NAMES[] = {"ok", "invalid register", "invalid label", "invalid address", "syntax error", "memory error"};
+
+struct BATCH_RESULT
+{
+	string program, trace;
+	bool opened = false;
+	int exitCode = 0;
+	long long cycles = 0, instructions = 0;
+	double seconds = 0;
+};
+
+// paths named by patterns, a pattern matching no file is kept as it is so that it is reported
+inline vector<string> expandPatterns(const vector<string> &patterns)
+{
+	vector<string> paths;
+	for (const string &pattern : patterns)
+	{
+		glob_t matches;
+		if (glob(pattern.c_str(), 0, nullptr, &matches) == 0)
+			paths.insert(paths.end(), matches.gl_pathv, matches.gl_pathv + matches.gl_pathc);
+		else
+			paths.push_back(pattern);
+		globfree(&matches);
+	}
+	return paths;
+}
+
+// path in directory of the output files of every program without their extension: its file name
+// without .asm. Programs of the same file name in different directories, or a program given twice,
+// would write the same files from two threads, so each one after the first gets -2, -3, ... added.
+inline vector<string> outputStems(const vector<string> &programs, const string &directory)
+{
+	vector<string> stems;
+	set<string> taken;
+	for (const string &program : programs)
+	{
+		string name = program.substr(program.find_last_of('/') + 1);
+		if (name.size() > 4 && name.compare(name.size() - 4, 4, ".asm") == 0)
+			name.resize(name.size() - 4);
+		string stem = name;
+		for (int copy = 2; !taken.insert(stem).second; ++copy)
+			stem = name + '-' + to_string(copy);
+		stems.push_back((directory.empty() ? "" : directory + "/") + stem);
+	}
+	return stems;
+}
+
+// run every program with its own engine built from options, the trace and messages of each one
+// going to its own .out file named by outputStems(). A binary trace goes to a .trace file, its
+// messages to a .err file and, with a trace index, its index to a .idx file next to it. A timeline
+// goes to a .timeline.json file.
+inline vector<BATCH_RESULT> runBatch(const vector<string> &programs, const SIMULATOR_OPTIONS &options, const string &directory, int threads)
+{
+	vector<BATCH_RESULT> results(programs.size());
+	vector<string> stems = outputStems(programs, directory);
+	auto simulate = [&](size_t i)
+	{
+		BATCH_RESULT &result = results[i];
+		result.program = programs[i];
+		bool binary = options.traceFormat == "binary";
+		result.trace = stems[i] + (binary ? ".trace" : ".out");
+		auto start = chrono::steady_clock::now();
+		ifstream file(result.program);
+		if (!file.is_open())
+			return;
+		ofstream trace(result.trace, ios::binary), messages;
+		if (binary)
+			messages.open(stems[i] + ".err");
+		if (!trace.is_open() || (binary && !messages.is_open()))
+			return;
+		result.opened = true;
+		SIMULATOR_OPTIONS run = options;
+		if (!options.traceIndex.empty())
+			run.traceIndex = stems[i] + ".idx";
+		if (!options.timeline.empty())
+			run.timeline = stems[i] + ".timeline.json";
+		unique_ptr<MIPS_Architecture> mips(run.create(file, trace, binary ? messages : trace));
+		mips->executeCommandsPipelined();
+		result.exitCode = mips->EXIT_CODE;
+		result.cycles = mips->cycleCount();
+		result.instructions = mips->instructionCount();
+		result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	};
+	WORK_STEALING_POOL::run(programs.size(), threads, simulate);
+	return results;
+}
+
+inline void printBatchSummary(ostream &out, const vector<BATCH_RESULT> &results, double seconds)
+{
+	size_t width = 7;
+	for (const BATCH_RESULT &result : results)
+		width = max(width, result.program.size());
+	int failed = 0;
+	out << left << setw(width) << "program" << right << setw(18) << "status" << setw(14) << "cycles" << setw(14) << "instructions" << setw(8) << "CPI" << setw(10) << "seconds" << '\n';
+	for (const BATCH_RESULT &result : results)
+	{
+		const char *status = !result.opened ? "not opened" : EXIT_CODE_NAMES[result.exitCode];
+		failed += !result.opened || result.exitCode != 0;
+		out << left << setw(width) << result.program << right << setw(18) << status << setw(14) << result.cycles << setw(14) << result.instructions
+			<< setw(8) << fixed << setprecision(3) << (result.instructions ? (double)result.cycles / result.instructions : 0.0)
+			<< setw(10) << setprecision(4) << result.seconds << defaultfloat << '\n';
+	}
+	out << results.size() << " programs, " << failed << " failed, " << fixed << setprecision(3) << seconds << " s\n"
+		<< defaultfloat;
+}
+
+#endif
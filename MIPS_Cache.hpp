@@ -0,0 +1,227 @@
+/**
+ * @file MIPS_Cache.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_CACHE_HPP__
+#define __MIPS_CACHE_HPP__
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+#include "MIPS_Checkpoint.hpp"
+
+using namespace std;
+
+// timing model of a set associative cache: it keeps tags only, the data stays in PAGED_MEMORY.
+// access() tells how many cycles a load or store spends in the stage on top of its latency.
+//   miss            PENALTY cycles to fetch the line
+//   write back      stores allocate on a miss and dirty the line, evicting a dirty line costs
+//                   another PENALTY cycles to write it back
+//   write through   stores never allocate and go to memory through a write buffer at no cost
+// SIZE == 0 disables the cache, every access then hits.
+struct CACHE_MODEL
+{
+	enum REPLACEMENT : uint8_t
+	{
+		REPLACE_LRU = 0,
+		REPLACE_RANDOM
+	};
+
+	struct LINE
+	{
+		uint32_t tag = 0;
+		bool valid = false;
+		bool dirty = false;
+		uint64_t lastUse = 0; // ACCESSES when the line was last used
+	};
+
+	// configuration
+	int SIZE = 0;  // bytes of data, 0 for no cache
+	int WAYS = 1;  // associativity
+	int LINE_SIZE = 32;
+	int PENALTY = 10; // cycles to fetch or write back a line
+	uint8_t REPLACEMENT = REPLACE_LRU;
+	bool WRITE_BACK = true;
+
+	// state
+	vector<LINE> lines; // set s holds lines [s * WAYS, (s + 1) * WAYS)
+	int SETS = 0;
+	uint32_t RANDOM_STATE = 2463534242u; // xorshift32
+
+	// counters
+	uint64_t ACCESSES = 0, READ_MISSES = 0, WRITES = 0, WRITE_MISSES = 0;
+	uint64_t EVICTIONS = 0, WRITEBACKS = 0, STALL_CYCLES = 0;
+
+	bool enabled() const
+	{
+		return SIZE > 0;
+	}
+
+	// comma separated "<key>=<value>" entries: size, ways, line, penalty in cycles,
+	// replacement=lru|random, write=back|through. Returns false on a malformed entry or a
+	// geometry which is not a power of 2 everywhere.
+	bool parse(const string &spec)
+	{
+		return parseList(spec, *this) && reset();
+	}
+
+	bool set(const string &entry)
+	{
+		size_t equal = entry.find('=');
+		if (equal == string::npos)
+			return false;
+		string key = entry.substr(0, equal), value = entry.substr(equal + 1);
+		if (key == "replacement" && (value == "lru" || value == "random"))
+			REPLACEMENT = value == "lru" ? REPLACE_LRU : REPLACE_RANDOM;
+		else if (key == "write" && (value == "back" || value == "through"))
+			WRITE_BACK = value == "back";
+		else
+		{
+			int number;
+			try
+			{
+				number = stoi(value);
+			}
+			catch (exception &e)
+			{
+				return false;
+			}
+			if (number < 0)
+				return false;
+			if (key == "size")
+				SIZE = number;
+			else if (key == "ways")
+				WAYS = number;
+			else if (key == "line")
+				LINE_SIZE = number;
+			else if (key == "penalty")
+				PENALTY = number;
+			else
+				return false;
+		}
+		return true;
+	}
+
+	static bool powerOfTwo(int n)
+	{
+		return n > 0 && (n & (n - 1)) == 0;
+	}
+
+	// empty the cache for the configured geometry, false if it is not a valid one
+	bool reset()
+	{
+		lines.clear();
+		SETS = 0;
+		ACCESSES = READ_MISSES = WRITES = WRITE_MISSES = EVICTIONS = WRITEBACKS = STALL_CYCLES = 0;
+		if (!enabled())
+			return true;
+		if (!powerOfTwo(SIZE) || !powerOfTwo(WAYS) || !powerOfTwo(LINE_SIZE) || LINE_SIZE < 4 || SIZE < WAYS * LINE_SIZE)
+			return false;
+		SETS = SIZE / (WAYS * LINE_SIZE);
+		lines.assign(SETS * WAYS, LINE());
+		return true;
+	}
+
+	// extra cycles of a load (write false) or store of the byte at address
+	int access(uint32_t address, bool write)
+	{
+		if (!enabled())
+			return 0;
+		ACCESSES++;
+		WRITES += write;
+		uint32_t block = address / LINE_SIZE;
+		LINE *set = lines.data() + (block & (SETS - 1)) * WAYS;
+		uint32_t tag = block / SETS;
+		for (int way = 0; way < WAYS; ++way)
+			if (set[way].valid && set[way].tag == tag)
+			{
+				set[way].lastUse = ACCESSES;
+				set[way].dirty |= write && WRITE_BACK;
+				return 0;
+			}
+
+		if (write)
+			WRITE_MISSES++;
+		else
+			READ_MISSES++;
+		if (write && !WRITE_BACK)
+			return 0; // no write allocate
+		LINE &victim = set[chooseVictim(set)];
+		int cycles = PENALTY;
+		if (victim.valid)
+		{
+			EVICTIONS++;
+			if (victim.dirty)
+			{
+				WRITEBACKS++;
+				cycles += PENALTY;
+			}
+		}
+		victim.valid = true;
+		victim.tag = tag;
+		victim.dirty = write;
+		victim.lastUse = ACCESSES;
+		STALL_CYCLES += cycles;
+		return cycles;
+	}
+
+	// way to refill in set: an invalid one if any, otherwise by the replacement policy
+	int chooseVictim(const LINE *set)
+	{
+		for (int way = 0; way < WAYS; ++way)
+			if (!set[way].valid)
+				return way;
+		if (REPLACEMENT == REPLACE_RANDOM)
+		{
+			RANDOM_STATE ^= RANDOM_STATE << 13;
+			RANDOM_STATE ^= RANDOM_STATE >> 17;
+			RANDOM_STATE ^= RANDOM_STATE << 5;
+			return RANDOM_STATE & (WAYS - 1);
+		}
+		int victim = 0;
+		for (int way = 1; way < WAYS; ++way)
+			if (set[way].lastUse < set[victim].lastUse)
+				victim = way;
+		return victim;
+	}
+
+	void save(CHECKPOINT_WRITER &out) const
+	{
+		out.put(SIZE), out.put(WAYS), out.put(LINE_SIZE), out.put(REPLACEMENT), out.put(WRITE_BACK);
+		out.putVector(lines);
+		out.put(RANDOM_STATE);
+		out.put(ACCESSES), out.put(READ_MISSES), out.put(WRITES), out.put(WRITE_MISSES);
+		out.put(EVICTIONS), out.put(WRITEBACKS), out.put(STALL_CYCLES);
+	}
+
+	// the state only restores into a cache of the same geometry and policies
+	bool load(CHECKPOINT_READER &in)
+	{
+		int size, ways, lineSize;
+		uint8_t replacement;
+		bool writeBack;
+		if (!in.get(size) || !in.get(ways) || !in.get(lineSize) || !in.get(replacement) || !in.get(writeBack))
+			return false;
+		if (size != SIZE || (enabled() && (ways != WAYS || lineSize != LINE_SIZE || replacement != REPLACEMENT || writeBack != WRITE_BACK)))
+			return false;
+		return in.getVector(lines) && lines.size() == (size_t)SETS * WAYS * enabled() && in.get(RANDOM_STATE) &&
+			   in.get(ACCESSES) && in.get(READ_MISSES) && in.get(WRITES) && in.get(WRITE_MISSES) &&
+			   in.get(EVICTIONS) && in.get(WRITEBACKS) && in.get(STALL_CYCLES);
+	}
+
+	void printStatistics(ostream &out, const char *name) const
+	{
+		uint64_t misses = READ_MISSES + WRITE_MISSES;
+		out << name << ": " << SIZE << " bytes, " << WAYS << " way, " << LINE_SIZE << " byte lines, "
+			<< (REPLACEMENT == REPLACE_LRU ? "LRU" : "random") << ", write " << (WRITE_BACK ? "back" : "through") << '\n';
+		out << name << " accesses: " << ACCESSES << " (" << ACCESSES - WRITES << " reads, " << WRITES << " writes), hits: " << ACCESSES - misses
+			<< ", misses: " << misses << " (" << READ_MISSES << " read, " << WRITE_MISSES << " write), hit rate: "
+			<< (ACCESSES ? 100.0 * (ACCESSES - misses) / ACCESSES : 100.0) << "%\n";
+		out << name << " evictions: " << EVICTIONS << ", write backs: " << WRITEBACKS << ", stall cycles: " << STALL_CYCLES << '\n';
+	}
+};
+
+#endif
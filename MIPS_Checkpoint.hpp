@@ -0,0 +1,149 @@
+/**
+ * @file MIPS_Checkpoint.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_CHECKPOINT_HPP__
+#define __MIPS_CHECKPOINT_HPP__
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "MIPS_Instruction.hpp"
+
+using namespace std;
+
+// on-disk checkpoint: a CHECKPOINT_HEADER followed by the state of the engine that wrote it, as
+// raw native-endian values in the order the engine saves them. A checkpoint is only restored
+// into the same engine running the same program, and only if VERSION matches.
+static const char CHECKPOINT_MAGIC[8] = {'M', 'I', 'P', 'S', 'C', 'K', 'P', 'T'};
+static const uint32_t CHECKPOINT_VERSION = 9;
+
+struct CHECKPOINT_HEADER
+{
+	char MAGIC[8];
+	uint32_t VERSION;
+	char ENGINE[12];	   // name of the engine, "stall", "forward" or "functional"
+	uint64_t PROGRAM_HASH; // programHash() of the decoded program
+	uint64_t SIZE;		   // bytes in the file, header included
+};
+
+// FNV-1a over the decoded program
+inline uint64_t programHash(const vector<DECODED_INSTRUCTION> &program)
+{
+	uint64_t hash = 14695981039346656037ull;
+	const unsigned char *bytes = (const unsigned char *)program.data();
+	for (size_t i = 0; i < program.size() * sizeof(DECODED_INSTRUCTION); ++i)
+		hash = (hash ^ bytes[i]) * 1099511628211ull;
+	return hash;
+}
+
+struct CHECKPOINT_WRITER
+{
+	vector<char> bytes;
+
+	void putBytes(const void *p, size_t n)
+	{
+		bytes.insert(bytes.end(), (const char *)p, (const char *)p + n);
+	}
+
+	template <class T>
+	void put(const T &value)
+	{
+		static_assert(is_trivially_copyable<T>::value, "checkpoint values are copied as raw bytes");
+		putBytes(&value, sizeof(T));
+	}
+
+	template <class T>
+	void putVector(const vector<T> &values)
+	{
+		static_assert(is_trivially_copyable<T>::value, "checkpoint values are copied as raw bytes");
+		put((uint64_t)values.size());
+		putBytes(values.data(), values.size() * sizeof(T));
+	}
+};
+
+// reads values back from a mapped checkpoint, every get fails once the data runs out
+struct CHECKPOINT_READER
+{
+	const char *p, *end;
+
+	bool getBytes(void *out, size_t n)
+	{
+		if ((size_t)(end - p) < n)
+			return false;
+		memcpy(out, p, n);
+		p += n;
+		return true;
+	}
+
+	// pointer to the next n bytes inside the mapping, nullptr if there are fewer left
+	const char *skip(size_t n)
+	{
+		if ((size_t)(end - p) < n)
+			return nullptr;
+		const char *at = p;
+		p += n;
+		return at;
+	}
+
+	template <class T>
+	bool get(T &value)
+	{
+		return getBytes(&value, sizeof(T));
+	}
+
+	template <class T>
+	bool getVector(vector<T> &values)
+	{
+		uint64_t n;
+		if (!get(n) || n > (uint64_t)(end - p) / sizeof(T))
+			return false;
+		values.resize(n);
+		return getBytes(values.data(), n * sizeof(T));
+	}
+};
+
+// read only mapping of a whole file
+struct MAPPED_FILE
+{
+	const char *data = nullptr;
+	size_t size = 0;
+
+	MAPPED_FILE(const string &path)
+	{
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return;
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p != MAP_FAILED)
+			{
+				data = (const char *)p;
+				size = st.st_size;
+			}
+		}
+		close(fd);
+	}
+
+	~MAPPED_FILE()
+	{
+		if (data)
+			munmap((void *)data, size);
+	}
+
+	MAPPED_FILE(const MAPPED_FILE &) = delete;
+	MAPPED_FILE &operator=(const MAPPED_FILE &) = delete;
+};
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * @file MIPS_Functional.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_FUNCTIONAL_HPP__
+#define __MIPS_FUNCTIONAL_HPP__
+
+#include <climits>
+#include "MIPS_Processor.hpp"
+
+using namespace std;
+
+// functional engine: runs the decoded program one instruction after the other on the registers
+// and data memory of MIPS_Architecture, without latches or timing. Only the final state, the
+// per instruction counts and the number of instructions executed are reported.
+struct MIPS_Functional : MIPS_Architecture
+{
+	long long INSTRUCTIONS_EXECUTED = 0;
+
+	MIPS_Functional(istream &file, ostream &output = cout, ostream &errors = cerr) : MIPS_Architecture(file, output, errors) {}
+	MIPS_Functional(shared_ptr<const MIPS_PROGRAM> image, ostream &output = cout, ostream &errors = cerr) : MIPS_Architecture(image, output, errors) {}
+
+	void executeCommandsPipelined()
+	{
+		if (!programLoaded())
+			return;
+		if (CHECKPOINT_AT >= 0 && CHECKPOINT_AT > INSTRUCTIONS_EXECUTED)
+		{
+			if (!run(CHECKPOINT_AT - INSTRUCTIONS_EXECUTED))
+				return;
+			if (current_PC < (int)program.size())
+				saveCheckpoint(CHECKPOINT_PATH);
+		}
+		if (!run())
+			return;
+		register_PRINT(INSTRUCTIONS_EXECUTED);
+		trace.flush();
+		handleExit(SUCCESS, INSTRUCTIONS_EXECUTED);
+	}
+
+	const char *engineName()
+	{
+		return "functional";
+	}
+
+	long long cycleCount()
+	{
+		return INSTRUCTIONS_EXECUTED;
+	}
+
+	long long instructionCount()
+	{
+		return INSTRUCTIONS_EXECUTED;
+	}
+
+	void saveState(CHECKPOINT_WRITER &out)
+	{
+		MIPS_Architecture::saveState(out);
+		out.put(INSTRUCTIONS_EXECUTED);
+	}
+
+	bool loadState(CHECKPOINT_READER &in)
+	{
+		return MIPS_Architecture::loadState(in) && in.get(INSTRUCTIONS_EXECUTED);
+	}
+
+	// execute from current_PC until the program ends or MAX_INSTRUCTIONS have been executed,
+	// returns false on an invalid instruction (after reporting it)
+	bool run(long long MAX_INSTRUCTIONS = LLONG_MAX)
+	{
+		const DECODED_INSTRUCTION *code = program.data();
+		const int size = program.size();
+		int *R = REGISTERS;
+		int pc = current_PC;
+		long long executed = INSTRUCTIONS_EXECUTED;
+		const long long limit = INSTRUCTIONS_EXECUTED + min(MAX_INSTRUCTIONS, LLONG_MAX - INSTRUCTIONS_EXECUTED);
+		const DECODED_INSTRUCTION *ins;
+
+#ifdef __GNUC__
+		// threaded dispatch, the table follows OPCODE
+		static void *const DISPATCH[OP_INVALID + 1] = {&&op_invalid, &&op_add, &&op_sub, &&op_mul, &&op_slt, &&op_addi, &&op_beq, &&op_bne, &&op_j, &&op_lw, &&op_sw, &&op_invalid};
+#define CASE(label, op) label:
+#define NEXT                                   \
+	if (pc >= size || executed == limit)       \
+		goto done;                             \
+	ins = code + pc;                           \
+	commandCount[pc]++;                        \
+	executed++;                                \
+	goto *DISPATCH[ins->op]
+		NEXT;
+#else
+#define CASE(label, op) case op:
+#define NEXT continue
+		while (pc < size && executed < limit)
+		{
+			ins = code + pc;
+			commandCount[pc]++;
+			executed++;
+			switch (ins->op)
+			{
+#endif
+		CASE(op_add, OP_ADD)
+		R[ins->rd] = R[ins->rs] + R[ins->rt];
+		pc++;
+		NEXT;
+		CASE(op_sub, OP_SUB)
+		R[ins->rd] = R[ins->rs] - R[ins->rt];
+		pc++;
+		NEXT;
+		CASE(op_mul, OP_MUL)
+		R[ins->rd] = R[ins->rs] * R[ins->rt];
+		pc++;
+		NEXT;
+		CASE(op_slt, OP_SLT)
+		R[ins->rd] = R[ins->rs] < R[ins->rt];
+		pc++;
+		NEXT;
+		CASE(op_addi, OP_ADDI)
+		R[ins->rd] = R[ins->rs] + ins->imm;
+		pc++;
+		NEXT;
+		CASE(op_beq, OP_BEQ)
+		pc = R[ins->rs] == R[ins->rt] ? ins->target : pc + 1;
+		NEXT;
+		CASE(op_bne, OP_BNE)
+		pc = R[ins->rs] != R[ins->rt] ? ins->target : pc + 1;
+		NEXT;
+		CASE(op_j, OP_J)
+		pc = ins->target;
+		NEXT;
+		CASE(op_lw, OP_LW)
+		R[ins->rd] = data.read((ins->imm + R[ins->rs]) / 4);
+		pc++;
+		NEXT;
+		CASE(op_sw, OP_SW)
+		data.write((ins->imm + R[ins->rs]) / 4, R[ins->rt]);
+		pc++;
+		NEXT;
+#ifdef __GNUC__
+	op_invalid:
+#else
+			default:
+#endif
+		current_PC = pc;
+		INSTRUCTIONS_EXECUTED = executed - 1;
+		commandCount[pc]--;
+		handleExit(SYNTAX_ERROR, INSTRUCTIONS_EXECUTED);
+		return false;
+#ifndef __GNUC__
+			}
+		}
+#endif
+#undef CASE
+#undef NEXT
+	done:
+		current_PC = pc;
+		INSTRUCTIONS_EXECUTED = executed;
+		return true;
+	}
+};
+
+#endif
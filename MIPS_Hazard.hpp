@@ -0,0 +1,194 @@
+/**
+ * @file MIPS_Hazard.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_HAZARD_HPP__
+#define __MIPS_HAZARD_HPP__
+
+#include <cstdint>
+#include <algorithm>
+#include <ostream>
+#include "MIPS_Instruction.hpp"
+
+using namespace std;
+
+// register scoreboard: which registers still have a write in flight. A write is in flight from
+// the cycle its command leaves ID until the cycle it is written back, so the scoreboard stays
+// right whatever the latency of the stages in between.
+struct SCOREBOARD
+{
+	uint32_t PENDING_WRITES = 0; // bit r set while a write to register r is in flight
+	uint8_t IN_FLIGHT[32] = {0}; // number of writes to r in flight
+	int STORE_ADDRESS = 0;		 // word address of the last store issued
+	int STORE_READY_CYCLE = 0;	 // cycle from which a load may follow that store
+
+	// first cycle at which ins can read all of its operands: cycle when nothing it reads is
+	// pending, otherwise it asks again in the next cycle
+	int readyCycle(const DECODED_INSTRUCTION &ins, int cycle)
+	{
+		return SOURCE_MASK(ins) & PENDING_WRITES ? cycle + 1 : cycle;
+	}
+
+	// first cycle at which a load of address may read memory behind the last store
+	int loadReadyCycle(int address, int cycle)
+	{
+		return address == STORE_ADDRESS && STORE_READY_CYCLE > cycle ? STORE_READY_CYCLE : cycle;
+	}
+
+	// ins leaves ID
+	void issue(const DECODED_INSTRUCTION &ins)
+	{
+		if (!WRITES_REGISTER(ins.op))
+			return;
+		IN_FLIGHT[ins.rd]++;
+		PENDING_WRITES |= 1u << ins.rd;
+	}
+
+	// ins writes its result back
+	void writeBack(const DECODED_INSTRUCTION &ins)
+	{
+		if (WRITES_REGISTER(ins.op) && --IN_FLIGHT[ins.rd] == 0)
+			PENDING_WRITES &= ~(1u << ins.rd);
+	}
+
+	// a store to address leaves ID, a load may only follow from readyCycle onwards
+	void issueStore(int address, int readyCycle)
+	{
+		STORE_ADDRESS = address;
+		STORE_READY_CYCLE = readyCycle;
+	}
+
+	void clear()
+	{
+		PENDING_WRITES = 0;
+		fill(IN_FLIGHT, IN_FLIGHT + 32, 0);
+		STORE_READY_CYCLE = 0;
+	}
+};
+
+// where the forwarding unit takes an operand from
+enum FORWARD_SOURCE : uint8_t
+{
+	FROM_REGISTER_FILE = 0,
+	FROM_EX_MEM,		// EX -> EX: ALU result of the command directly ahead
+	FROM_MEM_WB,		// MEM -> EX: ALU or load result of the command two ahead
+	FROM_MEM_WB_AT_MEM, // MEM -> MEM: load result directly ahead of a sw, used as its store data
+	FORWARD_SOURCES
+};
+
+// forwarding unit of the bypass pipeline, compares the source registers of the command in ID
+// against the producer tags held in the EX/MEM (L4) and MEM/WB (L5) latches
+struct FORWARDING_UNIT
+{
+	long long PATH_COUNT[FORWARD_SOURCES] = {0}; // how many operands were taken from each source
+
+	// mux select, indexed by (MEM/WB produces r) << 1 | (EX/MEM produces r), the newer result wins
+	static constexpr uint8_t MUX[4] = {FROM_REGISTER_FILE, FROM_EX_MEM, FROM_MEM_WB, FROM_EX_MEM};
+
+	// source of register r for the command in ID
+	uint8_t select(int r, const DECODED_INSTRUCTION &EX_MEM, const DECODED_INSTRUCTION &MEM_WB)
+	{
+		// a load in EX/MEM has no value yet, loadUseHazard keeps its consumers in ID
+		int index = (IS_ALU(EX_MEM.op) && EX_MEM.rd == r) | (WRITES_REGISTER(MEM_WB.op) && MEM_WB.rd == r) << 1;
+		uint8_t source = MUX[index];
+		PATH_COUNT[source]++;
+		return source;
+	}
+
+	// ins is a sw whose data register is loaded by the lw in EX/MEM, the value is forwarded
+	// MEM -> MEM once the sw reaches MEM instead of stalling
+	bool storeDataFromMemory(const DECODED_INSTRUCTION &ins, const DECODED_INSTRUCTION &EX_MEM)
+	{
+		if (ins.op != OP_SW || EX_MEM.op != OP_LW || EX_MEM.rd != ins.rt)
+			return false;
+		PATH_COUNT[FROM_MEM_WB_AT_MEM]++;
+		return true;
+	}
+
+	// ins needs the result of the lw in EX/MEM before it can leave ID
+	bool loadUseHazard(const DECODED_INSTRUCTION &ins, const DECODED_INSTRUCTION &EX_MEM)
+	{
+		if (EX_MEM.op != OP_LW)
+			return false;
+		uint32_t needed = ins.op == OP_SW ? 1u << ins.rs : SOURCE_MASK(ins);
+		return needed >> EX_MEM.rd & 1;
+	}
+
+	void printStatistics(ostream &out)
+	{
+		out << "Operands from register file: " << PATH_COUNT[FROM_REGISTER_FILE] << '\n';
+		out << "Operands forwarded EX->EX: " << PATH_COUNT[FROM_EX_MEM] << '\n';
+		out << "Operands forwarded MEM->EX: " << PATH_COUNT[FROM_MEM_WB] << '\n';
+		out << "Store data forwarded MEM->MEM: " << PATH_COUNT[FROM_MEM_WB_AT_MEM] << '\n';
+	}
+};
+
+// hazard policies of MIPS_Pipeline, each one answers for the command in ID
+//   readyCycle           first cycle at which it may leave ID (address: word address of a lw/sw)
+//   select               where operand register r is read from
+//   storeDataFromMemory  whether a sw takes its data MEM -> MEM
+//   issue                it leaves ID in cycle
+//   writeBack            a command writes its result back
+
+// stall-only pipeline (part 1): no bypass paths, operands are read from the register file once
+// the commands ahead have written them back
+struct STALL_POLICY
+{
+	static constexpr const char *NAME = "stall";
+
+	// a load may only leave ID STORE_TO_LOAD cycles after a store to the same address
+	static const int STORE_TO_LOAD = 2;
+	SCOREBOARD scoreboard;
+
+	int readyCycle(const DECODED_INSTRUCTION &ins, const DECODED_INSTRUCTION &, int address, int cycle)
+	{
+		int ready = scoreboard.readyCycle(ins, cycle);
+		if (ins.op == OP_LW) // a load directly behind a store to the same address waits for the store
+			ready = max(ready, scoreboard.loadReadyCycle(address, cycle));
+		return ready;
+	}
+
+	uint8_t select(int, const DECODED_INSTRUCTION &, const DECODED_INSTRUCTION &)
+	{
+		return FROM_REGISTER_FILE;
+	}
+
+	bool storeDataFromMemory(const DECODED_INSTRUCTION &, const DECODED_INSTRUCTION &)
+	{
+		return false;
+	}
+
+	void issue(const DECODED_INSTRUCTION &ins, int address, int cycle)
+	{
+		scoreboard.issue(ins);
+		if (ins.op == OP_SW)
+			scoreboard.issueStore(address, cycle + STORE_TO_LOAD);
+	}
+
+	void writeBack(const DECODED_INSTRUCTION &ins)
+	{
+		scoreboard.writeBack(ins);
+	}
+
+	void printStatistics(ostream &) {}
+};
+
+// bypassing pipeline (part 2): operands come through the forwarding unit, only a load-use
+// hazard costs a cycle
+struct FORWARD_POLICY : FORWARDING_UNIT
+{
+	static constexpr const char *NAME = "forward";
+
+	int readyCycle(const DECODED_INSTRUCTION &ins, const DECODED_INSTRUCTION &EX_MEM, int, int cycle)
+	{
+		return loadUseHazard(ins, EX_MEM) ? cycle + 1 : cycle;
+	}
+
+	void issue(const DECODED_INSTRUCTION &, int, int) {}
+
+	void writeBack(const DECODED_INSTRUCTION &) {}
+};
+
+#endif
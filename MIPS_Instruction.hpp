@@ -0,0 +1,251 @@
+/**
+ * @file MIPS_Instruction.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_INSTRUCTION_HPP__
+#define __MIPS_INSTRUCTION_HPP__
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <exception>
+
+using namespace std;
+
+enum OPCODE : uint8_t
+{
+	OP_NONE = 0, // empty latch / bubble
+	OP_ADD,
+	OP_SUB,
+	OP_MUL,
+	OP_SLT,
+	OP_ADDI,
+	OP_BEQ,
+	OP_BNE,
+	OP_J,
+	OP_LW,
+	OP_SW,
+	OP_INVALID // unknown mnemonic or malformed operand, reported when fetched
+};
+
+// pre-decoded instruction, built once at load time so that the pipeline never touches strings
+//   add/sub/mul/slt  rd <- rs op rt
+//   addi             rd <- rs + imm
+//   beq/bne          compare rs, rt and go to target
+//   j                go to target
+//   lw               rd <- data[(imm + rs) / 4]
+//   sw               data[(imm + rs) / 4] <- rt
+struct DECODED_INSTRUCTION
+{
+	uint8_t op = OP_NONE;
+	uint8_t rd = 0;
+	uint8_t rs = 0;
+	uint8_t rt = 0;
+	int32_t imm = 0;
+	int32_t target = 0; // resolved instruction index for beq/bne/j
+	int32_t pc = -1;	// index of the instruction in commands
+};
+
+// commands between IF and WB in program order. Every fetch gets the next sequence number, which
+// travels with the command through the latches (0 tags a bubble), so retiring the oldest command
+// and squashing the youngest one are tag compares at either end of the ring.
+struct IN_FLIGHT_BUFFER
+{
+	static const int CAPACITY = 16; // power of 2, more than the commands one per stage can hold
+
+	struct ENTRY
+	{
+		uint64_t seq;
+		int32_t pc;
+	};
+
+	ENTRY entries[CAPACITY];
+	int head = 0, count = 0;
+	uint64_t NEXT_SEQUENCE = 1;
+
+	bool empty() const
+	{
+		return count == 0;
+	}
+
+	int size() const
+	{
+		return count;
+	}
+
+	const ENTRY &front() const
+	{
+		return entries[head];
+	}
+
+	const ENTRY &back() const
+	{
+		return entries[(head + count - 1) & (CAPACITY - 1)];
+	}
+
+	// a command at pc is fetched, returns its sequence number
+	uint64_t push(int pc)
+	{
+		uint64_t seq = NEXT_SEQUENCE++;
+		entries[(head + count) & (CAPACITY - 1)] = {seq, pc};
+		count++;
+		return seq;
+	}
+
+	// the command tagged seq retires if it is the oldest one
+	bool retire(uint64_t seq)
+	{
+		if (count == 0 || entries[head].seq != seq)
+			return false;
+		head = (head + 1) & (CAPACITY - 1);
+		count--;
+		return true;
+	}
+
+	// the command tagged seq is squashed if it is the youngest one
+	bool squash(uint64_t seq)
+	{
+		if (count == 0 || back().seq != seq)
+			return false;
+		count--;
+		return true;
+	}
+};
+
+// instructions which write rd back to the register file
+inline bool WRITES_REGISTER(uint8_t op)
+{
+	return op == OP_ADD || op == OP_SUB || op == OP_MUL || op == OP_SLT || op == OP_ADDI || op == OP_LW;
+}
+
+// instructions whose result is produced by the ALU
+inline bool IS_ALU(uint8_t op)
+{
+	return op == OP_ADD || op == OP_SUB || op == OP_MUL || op == OP_SLT || op == OP_ADDI;
+}
+
+inline bool IS_BRANCH(uint8_t op)
+{
+	return op == OP_BEQ || op == OP_BNE;
+}
+
+// bit r is set when the instruction reads register r
+inline uint32_t SOURCE_MASK(const DECODED_INSTRUCTION &ins)
+{
+	switch (ins.op)
+	{
+	case OP_ADD:
+	case OP_SUB:
+	case OP_MUL:
+	case OP_SLT:
+	case OP_BEQ:
+	case OP_BNE:
+	case OP_SW:
+		return (1u << ins.rs) | (1u << ins.rt);
+	case OP_ADDI:
+	case OP_LW:
+		return 1u << ins.rs;
+	default:
+		return 0;
+	}
+}
+
+inline uint8_t decodeOpcode(const string &mnemonic)
+{
+	static const unordered_map<string, uint8_t> OPCODES = {{"add", OP_ADD}, {"sub", OP_SUB}, {"mul", OP_MUL}, {"slt", OP_SLT}, {"addi", OP_ADDI}, {"beq", OP_BEQ}, {"bne", OP_BNE}, {"j", OP_J}, {"lw", OP_LW}, {"sw", OP_SW}};
+	auto it = OPCODES.find(mnemonic);
+	return it == OPCODES.end() ? uint8_t(OP_INVALID) : it->second;
+}
+
+inline uint8_t decodeRegister(const string &name, const unordered_map<string, int> &registerMap)
+{
+	auto it = registerMap.find(name);
+	return it == registerMap.end() ? 0 : it->second;
+}
+
+// decode a parsed command (as stored in commands) into its compact form
+inline DECODED_INSTRUCTION decodeInstruction(const vector<string> &command, int pc, const unordered_map<string, int> &registerMap, const unordered_map<string, int> &address)
+{
+	DECODED_INSTRUCTION ins;
+	ins.op = decodeOpcode(command[0]);
+	ins.pc = pc;
+	try
+	{
+		switch (ins.op)
+		{
+		case OP_ADD:
+		case OP_SUB:
+		case OP_MUL:
+		case OP_SLT:
+			ins.rd = decodeRegister(command[1], registerMap);
+			ins.rs = decodeRegister(command[2], registerMap);
+			ins.rt = decodeRegister(command[3], registerMap);
+			break;
+		case OP_ADDI:
+			ins.rd = decodeRegister(command[1], registerMap);
+			ins.rs = decodeRegister(command[2], registerMap);
+			ins.imm = stoi(command[3]);
+			break;
+		case OP_BEQ:
+		case OP_BNE:
+		{
+			ins.rs = decodeRegister(command[1], registerMap);
+			ins.rt = decodeRegister(command[2], registerMap);
+			auto it = address.find(command[3]);
+			ins.target = it == address.end() ? 0 : it->second;
+			break;
+		}
+		case OP_J:
+		{
+			auto it = address.find(command[1]);
+			ins.target = it == address.end() ? 0 : it->second;
+			break;
+		}
+		case OP_LW:
+		case OP_SW:
+		{
+			// location is of the form offset($base)
+			const string &location = command[2];
+			int pos1 = location.find("(");
+			int pos2 = location.find(")");
+			ins.imm = stoi(location.substr(0, pos1));
+			ins.rs = decodeRegister(location.substr(pos1 + 1, pos2 - pos1 - 1), registerMap);
+			if (ins.op == OP_LW)
+				ins.rd = decodeRegister(command[1], registerMap);
+			else
+				ins.rt = decodeRegister(command[1], registerMap);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+	catch (exception &e)
+	{
+		ins.op = OP_INVALID;
+	}
+	return ins;
+}
+
+// hand every entry of the comma separated list spec to option.set(), false on the first one it
+// rejects
+template <class OPTION>
+bool parseList(const string &spec, OPTION &option)
+{
+	size_t begin = 0;
+	while (begin <= spec.size())
+	{
+		size_t end = spec.find(',', begin);
+		if (end == string::npos)
+			end = spec.size();
+		if (!option.set(spec.substr(begin, end - begin)))
+			return false;
+		begin = end + 1;
+	}
+	return true;
+}
+
+#endif
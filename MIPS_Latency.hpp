@@ -0,0 +1,102 @@
+/**
+ * @file MIPS_Latency.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_LATENCY_HPP__
+#define __MIPS_LATENCY_HPP__
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include "MIPS_Instruction.hpp"
+
+using namespace std;
+
+enum PIPELINE_STAGE : uint8_t
+{
+	STAGE_IF = 0,
+	STAGE_ID,
+	STAGE_EX,
+	STAGE_MEM,
+	STAGE_WB,
+	STAGES
+};
+
+static const char *const STAGE_NAMES[STAGES] = {"IF", "ID", "EX", "MEM", "WB"};
+
+// cycles a command spends in each pipeline stage, by opcode. A stage holds a command for that many
+// cycles, passing bubbles on and holding every stage before it. The assignment pipeline takes one
+// cycle everywhere.
+//
+// EMULATED_DELAY_NS is host time burnt for every simulated cycle, for experiments which need a
+// slower simulator. It is off by default and never changes the simulated timing.
+struct LATENCY_MODEL
+{
+	//                                   IF ID EX MEM WB
+	uint8_t CYCLES[OP_INVALID + 1][STAGES] = {{1, 1, 1, 1, 1},  // bubble
+											  {1, 1, 1, 1, 1},  // add
+											  {1, 1, 1, 1, 1},  // sub
+											  {1, 1, 1, 1, 1},  // mul
+											  {1, 1, 1, 1, 1},  // slt
+											  {1, 1, 1, 1, 1},  // addi
+											  {1, 1, 1, 1, 1},  // beq
+											  {1, 1, 1, 1, 1},  // bne
+											  {1, 1, 1, 1, 1},  // j
+											  {1, 1, 1, 1, 1},  // lw
+											  {1, 1, 1, 1, 1},  // sw
+											  {1, 1, 1, 1, 1}}; // invalid
+	long long EMULATED_DELAY_NS = 0;
+
+	int cycles(uint8_t op, int stage) const
+	{
+		return CYCLES[op][stage];
+	}
+
+	// one entry "<mnemonic>.<stage>=<cycles>", e.g. "mul.EX=4", mnemonic * sets every instruction,
+	// returns false on a malformed entry
+	bool set(const string &entry)
+	{
+		size_t dot = entry.find('.'), equal = entry.find('=');
+		if (dot == string::npos || equal == string::npos || equal < dot)
+			return false;
+		string mnemonic = entry.substr(0, dot), stageName = entry.substr(dot + 1, equal - dot - 1);
+		int stage = 0;
+		while (stage < STAGES && stageName != STAGE_NAMES[stage])
+			++stage;
+		uint8_t op = mnemonic == "*" ? uint8_t(OP_NONE) : decodeOpcode(mnemonic);
+		int value;
+		try
+		{
+			value = stoi(entry.substr(equal + 1));
+		}
+		catch (exception &e)
+		{
+			return false;
+		}
+		if (stage == STAGES || op == OP_INVALID || value < 1 || value > 255)
+			return false;
+		for (int o = OP_ADD; o < OP_INVALID; ++o)
+			if (op == OP_NONE || op == o)
+				CYCLES[o][stage] = value;
+		return true;
+	}
+
+	// comma separated list of entries for set()
+	bool parse(const string &spec)
+	{
+		return parseList(spec, *this);
+	}
+
+	void emulateDelay() const
+	{
+		if (EMULATED_DELAY_NS <= 0)
+			return;
+		auto end = chrono::steady_clock::now() + chrono::nanoseconds(EMULATED_DELAY_NS);
+		while (chrono::steady_clock::now() < end)
+			;
+	}
+};
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file MIPS_Memory.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_MEMORY_HPP__
+#define __MIPS_MEMORY_HPP__
+
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+// sparse word addressed data memory: 4 KB pages are allocated when first written, reads of an
+// untouched page return 0 without allocating it. Word addresses are 32 bit, so the address space
+// is not limited to the 1 MB of the assignment.
+struct PAGED_MEMORY
+{
+	static const int PAGE_BITS = 10; // 1024 words = 4 KB per page
+	static const int PAGE_WORDS = 1 << PAGE_BITS;
+	static const int CACHE_SIZE = 64; // entries of the direct mapped page cache, a power of 2
+
+	struct PAGE
+	{
+		int words[PAGE_WORDS] = {0};
+	};
+
+	struct CACHE_ENTRY
+	{
+		uint32_t number = UINT32_MAX; // page number, never a valid one while empty
+		PAGE *page = nullptr;
+	};
+
+	unordered_map<uint32_t, unique_ptr<PAGE>> pages;
+	CACHE_ENTRY cache[CACHE_SIZE];
+
+	// page holding page number, nullptr if it was never written
+	PAGE *findPage(uint32_t number)
+	{
+		CACHE_ENTRY &entry = cache[number & (CACHE_SIZE - 1)];
+		if (entry.number == number)
+			return entry.page;
+		auto it = pages.find(number);
+		if (it == pages.end())
+			return nullptr;
+		entry.number = number;
+		entry.page = it->second.get();
+		return entry.page;
+	}
+
+	// page holding page number, allocated on first touch
+	PAGE *touchPage(uint32_t number)
+	{
+		PAGE *page = findPage(number);
+		if (page)
+			return page;
+		page = (pages[number] = make_unique<PAGE>()).get();
+		CACHE_ENTRY &entry = cache[number & (CACHE_SIZE - 1)];
+		entry.number = number;
+		entry.page = page;
+		return page;
+	}
+
+	int read(uint32_t word)
+	{
+		PAGE *page = findPage(word >> PAGE_BITS);
+		return page ? page->words[word & (PAGE_WORDS - 1)] : 0;
+	}
+
+	void write(uint32_t word, int value)
+	{
+		PAGE *page = touchPage(word >> PAGE_BITS);
+		page->words[word & (PAGE_WORDS - 1)] = value;
+	}
+
+	// numbers of the allocated pages in increasing order
+	vector<uint32_t> touchedPages() const
+	{
+		vector<uint32_t> numbers;
+		numbers.reserve(pages.size());
+		for (auto &p : pages)
+			numbers.push_back(p.first);
+		sort(numbers.begin(), numbers.end());
+		return numbers;
+	}
+
+	void clear()
+	{
+		pages.clear();
+		for (auto &entry : cache)
+			entry = CACHE_ENTRY();
+	}
+};
+
+#endif
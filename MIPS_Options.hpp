@@ -0,0 +1,146 @@
+/**
+ * @file MIPS_Options.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_OPTIONS_HPP__
+#define __MIPS_OPTIONS_HPP__
+
+#include <string>
+#include <istream>
+#include <ostream>
+#include <fstream>
+#include "MIPS_Functional.hpp"
+
+using namespace std;
+
+// simulator command line options, and the engine they describe. Every engine built by create()
+// is an independent instance writing only to the streams it is given.
+struct SIMULATOR_OPTIONS
+{
+	string engine = "stall", mode = "pipeline", traceFormat = "text", traceIndex, timeline, checkpoint, restore;
+	long long checkpointAt = -1;
+	LATENCY_MODEL latency;
+	FUNCTIONAL_UNITS units;
+	BRANCH_PREDICTOR predictor;
+	CACHE_MODEL dcache, icache;
+	TRACE_POLICY tracePolicy;
+	int fetchQueue = 0, loopBuffer = 0;
+	bool statistics = false, eventDriven = false, asyncTrace = false;
+	bool malformed = false; // some option had a bad value
+
+	static constexpr const char *USAGE = "[--mode=pipeline|functional] [--engine=stall|forward] [--latency=<op>.<stage>=<cycles>,...] [--units=<alu|mul>:<latency>[:<interval>],...] [--emulated-delay=<ns per cycle>] [--predictor=none|not-taken|backward-taken|1bit|2bit|gshare[:<table bits>]] [--btb=<entries, with a predictor>] [--dcache=size=<bytes>,ways=<n>,line=<bytes>,penalty=<cycles>,replacement=lru|random,write=back|through] [--icache=<as --dcache>] [--fetch-queue=<0-8>] [--loop-buffer=<commands>] [--event-driven] [--trace=all|none|final|every:<n>|window:<first>-<last>] [--trace-format=text|binary] [--trace-index=<file>] [--async-trace] [--timeline=<file>] [--stats]";
+
+	// one "--<name>=<value>" option, false if it is not a simulator option. A bad value sets
+	// malformed.
+	bool set(const string &arg)
+	{
+		bool valid = true;
+		if (arg.rfind("--engine=", 0) == 0)
+			engine = arg.substr(9);
+		else if (arg.rfind("--mode=", 0) == 0)
+			mode = arg.substr(7);
+		else if (arg.rfind("--latency=", 0) == 0)
+			valid = latency.parse(arg.substr(10));
+		else if (arg.rfind("--predictor=", 0) == 0)
+			valid = predictor.parse(arg.substr(12));
+		else if (arg.rfind("--btb=", 0) == 0)
+			valid = predictor.setBTB(atoi(arg.substr(6).c_str()));
+		else if (arg.rfind("--dcache=", 0) == 0)
+			valid = dcache.parse(arg.substr(9));
+		else if (arg.rfind("--icache=", 0) == 0)
+			valid = icache.parse(arg.substr(9));
+		else if (arg.rfind("--fetch-queue=", 0) == 0)
+			fetchQueue = atoi(arg.substr(14).c_str());
+		else if (arg.rfind("--loop-buffer=", 0) == 0)
+			loopBuffer = atoi(arg.substr(14).c_str());
+		else if (arg == "--event-driven")
+			eventDriven = true;
+		else if (arg.rfind("--trace=", 0) == 0)
+			valid = tracePolicy.parse(arg.substr(8));
+		else if (arg.rfind("--trace-format=", 0) == 0)
+			traceFormat = arg.substr(15);
+		else if (arg.rfind("--trace-index=", 0) == 0)
+			traceIndex = arg.substr(14);
+		else if (arg.rfind("--timeline=", 0) == 0)
+			timeline = arg.substr(11);
+		else if (arg == "--async-trace")
+			asyncTrace = true;
+		else if (arg == "--stats")
+			statistics = true;
+		else if (arg.rfind("--units=", 0) == 0)
+			valid = units.parse(arg.substr(8));
+		else if (arg.rfind("--checkpoint=", 0) == 0)
+			checkpoint = arg.substr(13);
+		else if (arg.rfind("--checkpoint-at=", 0) == 0)
+			checkpointAt = atoll(arg.substr(16).c_str());
+		else if (arg.rfind("--restore=", 0) == 0)
+			restore = arg.substr(10);
+		else if (arg.rfind("--emulated-delay=", 0) == 0)
+			latency.EMULATED_DELAY_NS = atoll(arg.substr(17).c_str());
+		else
+			return false;
+		malformed |= !valid;
+		return true;
+	}
+
+	// every option has a value it may take
+	bool wellFormed() const
+	{
+		return !malformed && (engine == "stall" || engine == "forward") && (mode == "pipeline" || mode == "functional") &&
+			   (traceFormat == "text" || traceFormat == "binary") && fetchQueue >= 0 && fetchQueue <= MIPS_Pipeline<STALL_POLICY>::MAX_FETCH_QUEUE && loopBuffer >= 0;
+	}
+
+	// and the options go together
+	bool valid() const
+	{
+		return wellFormed() && (traceIndex.empty() || (traceFormat == "binary" && tracePolicy.KIND == TRACE_ALL)) &&
+			   (timeline.empty() || mode == "pipeline") && (predictor.BTB_ENTRIES == 0 || predictor.enabled()) &&
+			   (checkpointAt >= 0) == !checkpoint.empty();
+	}
+
+	// engine running the program in file, configured by these options
+	MIPS_Architecture *create(istream &file, ostream &output, ostream &errors) const
+	{
+		return create(make_shared<const MIPS_PROGRAM>(file), output, errors);
+	}
+
+	// engine running a loaded program, which it shares with the other engines given the same image
+	MIPS_Architecture *create(shared_ptr<const MIPS_PROGRAM> image, ostream &output, ostream &errors) const
+	{
+		MIPS_Architecture *mips;
+		if (mode == "functional")
+			mips = new MIPS_Functional(image, output, errors);
+		else if (engine == "forward")
+			mips = new MIPS_Pipeline<FORWARD_POLICY>(image, output, errors);
+		else
+			mips = new MIPS_Pipeline<STALL_POLICY>(image, output, errors);
+		mips->latency = latency;
+		mips->units = units;
+		mips->predictor = predictor;
+		mips->dcache = dcache;
+		mips->icache = icache;
+		mips->FETCH_QUEUE_SIZE = fetchQueue;
+		mips->LOOP_BUFFER_SIZE = loopBuffer;
+		mips->PRINT_STATISTICS = statistics;
+		mips->EVENT_DRIVEN = eventDriven;
+		mips->trace.BINARY = traceFormat == "binary";
+		mips->trace.POLICY = tracePolicy;
+		if (!traceIndex.empty())
+		{
+			mips->trace.INDEX.reset(new ofstream(traceIndex, ios::binary));
+			if (!*mips->trace.INDEX)
+				errors << "Trace index could not be opened, the trace is not indexed\n";
+		}
+		if (asyncTrace)
+			startAsyncTrace(mips->trace);
+		if (!timeline.empty() && !mips->timeline.open(timeline, mips->commands))
+			errors << "Timeline could not be opened, none is written\n";
+		mips->CHECKPOINT_AT = checkpointAt;
+		mips->CHECKPOINT_PATH = checkpoint;
+		return mips;
+	}
+};
+
+#endif
@@ -0,0 +1,210 @@
+/**
+ * @file MIPS_Predictor.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_PREDICTOR_HPP__
+#define __MIPS_PREDICTOR_HPP__
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+#include "MIPS_Instruction.hpp"
+
+using namespace std;
+
+enum PREDICTOR_KIND : uint8_t
+{
+	PREDICT_NONE = 0,		// no prediction: every beq/bne flushes the pipeline when it resolves
+	PREDICT_NOT_TAKEN,		// static, always fall through
+	PREDICT_BACKWARD_TAKEN, // static, taken when the target is not after the branch
+	PREDICT_ONE_BIT,		// last outcome of the branch
+	PREDICT_TWO_BIT,		// saturating 2 bit counter per branch
+	PREDICT_GSHARE,			// 2 bit counters indexed by pc xor global history
+	PREDICTOR_KINDS
+};
+
+static const char *const PREDICTOR_NAMES[PREDICTOR_KINDS] = {"none", "not-taken", "backward-taken", "1bit", "2bit", "gshare"};
+
+// beq/bne prediction in the fetch stage. IF asks for the PC to fetch after a branch, EX compares it
+// with the outcome and, when they differ, flushes the command fetched behind the branch the same
+// way every branch did without a predictor.
+//
+// The BHT has 1 << TABLE_BITS entries indexed by the branch index (xor the global history for
+// gshare). With BTB_ENTRIES == 0 the target of a predicted taken branch comes from the decoded
+// program, otherwise a taken prediction only redirects fetch on a hit in a direct mapped BTB.
+// Tables and history are updated when the branch resolves in EX.
+struct BRANCH_PREDICTOR
+{
+	static const int MAX_TABLE_BITS = 20;
+
+	struct BTB_ENTRY
+	{
+		int32_t pc = -1; // branch index, -1 while empty
+		int32_t target = 0;
+	};
+
+	struct BRANCH_STATISTICS
+	{
+		uint64_t RESOLVED = 0;
+		uint64_t MISPREDICTED = 0;
+		uint64_t TAKEN = 0;
+	};
+
+	uint8_t KIND = PREDICT_NONE;
+	int TABLE_BITS = 10;
+	int BTB_ENTRIES = 0;
+	vector<uint8_t> COUNTERS; // BHT, one bit or two bit counters
+	vector<BTB_ENTRY> BTB;
+	uint32_t HISTORY = 0;			   // outcomes of the last TABLE_BITS branches, newest in bit 0
+	vector<BRANCH_STATISTICS> BRANCHES; // by branch index
+	uint64_t BTB_MISSES = 0;			// taken predictions which fell through for want of a target
+	uint64_t PENALTY_CYCLES = 0;		// fetch cycles lost to mispredictions
+
+	// "<kind>[:<table bits>]", e.g. "2bit" or "gshare:12", returns false on a malformed spec
+	bool parse(const string &spec)
+	{
+		size_t colon = spec.find(':');
+		string name = spec.substr(0, colon);
+		int kind = 0;
+		while (kind < PREDICTOR_KINDS && name != PREDICTOR_NAMES[kind])
+			++kind;
+		if (kind == PREDICTOR_KINDS)
+			return false;
+		if (colon != string::npos)
+		{
+			try
+			{
+				TABLE_BITS = stoi(spec.substr(colon + 1));
+			}
+			catch (exception &e)
+			{
+				return false;
+			}
+			if (TABLE_BITS < 1 || TABLE_BITS > MAX_TABLE_BITS)
+				return false;
+		}
+		KIND = kind;
+		reset();
+		return true;
+	}
+
+	bool setBTB(int entries)
+	{
+		if (entries < 0 || entries & (entries - 1))
+			return false; // a power of 2, or 0 for none
+		BTB_ENTRIES = entries;
+		reset();
+		return true;
+	}
+
+	void reset()
+	{
+		// two bit counters start weakly not taken
+		COUNTERS.assign(KIND == PREDICT_ONE_BIT || KIND == PREDICT_TWO_BIT || KIND == PREDICT_GSHARE ? 1 << TABLE_BITS : 0, KIND == PREDICT_ONE_BIT ? 0 : 1);
+		BTB.assign(BTB_ENTRIES, BTB_ENTRY());
+		HISTORY = 0;
+		BRANCHES.clear();
+		BTB_MISSES = PENALTY_CYCLES = 0;
+	}
+
+	bool enabled() const
+	{
+		return KIND != PREDICT_NONE;
+	}
+
+	int index(int pc) const
+	{
+		uint32_t i = KIND == PREDICT_GSHARE ? pc ^ HISTORY : pc;
+		return i & ((1u << TABLE_BITS) - 1);
+	}
+
+	bool predictTaken(const DECODED_INSTRUCTION &ins) const
+	{
+		switch (KIND)
+		{
+		case PREDICT_BACKWARD_TAKEN:
+			return ins.target <= ins.pc;
+		case PREDICT_ONE_BIT:
+			return COUNTERS[index(ins.pc)];
+		case PREDICT_TWO_BIT:
+		case PREDICT_GSHARE:
+			return COUNTERS[index(ins.pc)] >= 2;
+		default:
+			return false;
+		}
+	}
+
+	// index of the command to fetch after the branch ins
+	int predict(const DECODED_INSTRUCTION &ins)
+	{
+		if (!predictTaken(ins))
+			return ins.pc + 1;
+		if (BTB_ENTRIES == 0)
+			return ins.target;
+		const BTB_ENTRY &entry = BTB[ins.pc & (BTB_ENTRIES - 1)];
+		if (entry.pc == ins.pc)
+			return entry.target;
+		BTB_MISSES++;
+		return ins.pc + 1;
+	}
+
+	// the branch ins resolved in EX, fetch had gone on at predicted
+	void update(const DECODED_INSTRUCTION &ins, bool taken, int predicted)
+	{
+		if ((int)BRANCHES.size() <= ins.pc)
+			BRANCHES.resize(ins.pc + 1);
+		BRANCH_STATISTICS &branch = BRANCHES[ins.pc];
+		branch.RESOLVED++;
+		branch.TAKEN += taken;
+		branch.MISPREDICTED += predicted != (taken ? ins.target : ins.pc + 1);
+
+		if (!COUNTERS.empty())
+		{
+			uint8_t &counter = COUNTERS[index(ins.pc)];
+			if (KIND == PREDICT_ONE_BIT)
+				counter = taken;
+			else if (taken && counter < 3)
+				counter++;
+			else if (!taken && counter > 0)
+				counter--;
+		}
+		HISTORY = (HISTORY << 1 | taken) & ((1u << TABLE_BITS) - 1);
+		if (taken && BTB_ENTRIES > 0)
+			BTB[ins.pc & (BTB_ENTRIES - 1)] = {ins.pc, ins.target};
+	}
+
+	void printStatistics(ostream &out, const vector<vector<string>> &commands) const
+	{
+		uint64_t resolved = 0, mispredicted = 0;
+		for (const BRANCH_STATISTICS &branch : BRANCHES)
+			resolved += branch.RESOLVED, mispredicted += branch.MISPREDICTED;
+		out << "Branch predictor: " << PREDICTOR_NAMES[KIND];
+		if (!COUNTERS.empty())
+			out << ", " << COUNTERS.size() << " entries";
+		if (BTB_ENTRIES > 0)
+			out << ", BTB of " << BTB_ENTRIES << " entries (" << BTB_MISSES << " misses)";
+		out << '\n';
+		out << "Branches resolved: " << resolved << ", mispredicted: " << mispredicted << ", accuracy: " << accuracy(resolved, mispredicted) << "%\n";
+		out << "Cycles lost to mispredictions: " << PENALTY_CYCLES << '\n';
+		for (int pc = 0; pc < (int)BRANCHES.size(); ++pc)
+		{
+			const BRANCH_STATISTICS &branch = BRANCHES[pc];
+			if (branch.RESOLVED == 0)
+				continue;
+			out << branch.RESOLVED - branch.MISPREDICTED << '/' << branch.RESOLVED << " predicted (" << accuracy(branch.RESOLVED, branch.MISPREDICTED) << "%), " << branch.TAKEN << " taken:\t";
+			for (auto &s : commands[pc])
+				out << s << ' ';
+			out << '\n';
+		}
+	}
+
+	static double accuracy(uint64_t resolved, uint64_t mispredicted)
+	{
+		return resolved ? 100.0 * (resolved - mispredicted) / resolved : 100.0;
+	}
+};
+
+#endif
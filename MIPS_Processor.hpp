@@ -0,0 +1,1185 @@
+/**
+ * @file MIPS_Processor.hpp
+ * @author Mallika Prabhakar and Sayam Sethi
+ *
+ */
+
+#ifndef __MIPS_PROCESSOR_HPP__
+#define __MIPS_PROCESSOR_HPP__
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <exception>
+#include <iostream>
+#include <climits>
+#include <memory>
+#include <sstream>
+#include <boost/tokenizer.hpp>
+#include "MIPS_Instruction.hpp"
+#include "MIPS_Hazard.hpp"
+#include "MIPS_Memory.hpp"
+#include "MIPS_Trace.hpp"
+#include "MIPS_Latency.hpp"
+#include "MIPS_Checkpoint.hpp"
+#include "MIPS_Predictor.hpp"
+#include "MIPS_Cache.hpp"
+#include "MIPS_Units.hpp"
+#include "MIPS_Stats.hpp"
+#include "MIPS_Timeline.hpp"
+
+using namespace std;
+
+enum exit_code
+{
+	SUCCESS = 0,
+	INVALID_REGISTER,
+	INVALID_LABEL,
+	INVALID_ADDRESS,
+	SYNTAX_ERROR,
+	MEMORY_ERROR
+};
+
+// a program as loaded from its source: the commands, their decoded form and the problems found on
+// the way. It does not change once loaded, so any number of engines may run the same one.
+struct MIPS_PROGRAM
+{
+	unordered_map<string, int> registerMap, address;
+	vector<vector<string>> commands;
+	vector<DECODED_INSTRUCTION> program;
+	vector<int> commandLine;					   // source line of each command
+	unordered_map<string, vector<int>> labelLines; // source lines defining each label
+	int LINE_NUMBER = 0;						   // line being parsed
+	exit_code LOAD_ERROR = SUCCESS;				   // first problem found while loading the program
+	int ERROR_PC = 0;							   // command of LOAD_ERROR
+	string LOAD_MESSAGES;						   // every problem found, one per line
+
+	MIPS_PROGRAM(istream &file)
+	{
+		for (int i = 0; i < 32; ++i)
+			registerMap["$" + to_string(i)] = i;
+		registerMap["$zero"] = 0;
+		registerMap["$at"] = 1;
+		registerMap["$v0"] = 2;
+		registerMap["$v1"] = 3;
+		for (int i = 0; i < 4; ++i)
+			registerMap["$a" + to_string(i)] = i + 4;
+		for (int i = 0; i < 8; ++i)
+			registerMap["$t" + to_string(i)] = i + 8, registerMap["$s" + to_string(i)] = i + 16;
+		registerMap["$t8"] = 24;
+		registerMap["$t9"] = 25;
+		registerMap["$k0"] = 26;
+		registerMap["$k1"] = 27;
+		registerMap["$gp"] = 28;
+		registerMap["$sp"] = 29;
+		registerMap["$s8"] = 30;
+		registerMap["$ra"] = 31;
+
+		constructCommands(file);
+		resolveLabels();
+		decodeCommands();
+	}
+
+	// checks if label is valid
+	bool LABEL_CHECK(string str)
+	{
+		return str.size() > 0 && isalpha(str[0]) && all_of(++str.begin(), str.end(), [](char c)
+														   { return (bool)isalnum(c); }) &&
+			   decodeOpcode(str) == OP_INVALID;
+	}
+
+	// parse the command assuming correctly formatted MIPS instruction (or label)
+	void parseCommand(string line)
+	{
+		// strip until before the comment begins
+		line = line.substr(0, line.find('#'));
+		vector<string> command;
+		boost::tokenizer<boost::char_separator<char>> tokens(line, boost::char_separator<char>(", \t"));
+		for (auto &s : tokens)
+			command.push_back(s);
+		// empty line or a comment only line
+		if (command.empty())
+			return;
+		else if (command.size() == 1)
+		{
+			string label = command[0].back() == ':' ? command[0].substr(0, command[0].size() - 1) : "?";
+			defineLabel(label);
+			command.clear();
+		}
+		else if (command[0].back() == ':')
+		{
+			string label = command[0].substr(0, command[0].size() - 1);
+			defineLabel(label);
+			command = vector<string>(command.begin() + 1, command.end());
+		}
+		else if (command[0].find(':') != string::npos)
+		{
+			int idx = command[0].find(':');
+			string label = command[0].substr(0, idx);
+			defineLabel(label);
+			command[0] = command[0].substr(idx + 1);
+		}
+		else if (command[1][0] == ':')
+		{
+			defineLabel(command[0]);
+			command[1] = command[1].substr(1);
+			if (command[1] == "")
+				command.erase(command.begin(), command.begin() + 2);
+			else
+				command.erase(command.begin(), command.begin() + 1);
+		}
+		if (command.empty())
+			return;
+		if (command.size() > 4)
+			for (int i = 4; i < (int)command.size(); ++i)
+				command[3] += " " + command[i];
+		command.resize(4);
+		commands.push_back(command);
+		commandLine.push_back(LINE_NUMBER);
+	}
+
+	// label is defined at the next command, -1 marks a label defined more than once
+	void defineLabel(const string &label)
+	{
+		if (address.find(label) == address.end())
+			address[label] = commands.size();
+		else
+			address[label] = -1;
+		labelLines[label].push_back(LINE_NUMBER);
+	}
+
+	void constructCommands(istream &file)
+	{
+		string line;
+		while (getline(file, line))
+		{
+			++LINE_NUMBER;
+			parseCommand(line);
+		}
+	}
+
+	// check every label used by beq/bne/j once after loading, so that decodeCommands can resolve
+	// them to instruction indices. Problems are listed in LOAD_MESSAGES, with their line numbers,
+	// the first one is kept in LOAD_ERROR with ERROR_PC at its command.
+	void resolveLabels()
+	{
+		ostringstream messages;
+		for (int i = 0; i < (int)commands.size(); ++i)
+		{
+			const vector<string> &command = commands[i];
+			uint8_t op = decodeOpcode(command[0]);
+			if (op != OP_BEQ && op != OP_BNE && op != OP_J)
+				continue;
+			const string &label = op == OP_J ? command[1] : command[3];
+			auto it = address.find(label);
+			exit_code error = SUCCESS;
+			if (!LABEL_CHECK(label))
+			{
+				messages << "Line " << commandLine[i] << ": invalid label " << label << '\n';
+				error = SYNTAX_ERROR;
+			}
+			else if (it == address.end())
+			{
+				messages << "Line " << commandLine[i] << ": label " << label << " is not defined\n";
+				error = INVALID_LABEL;
+			}
+			else if (it->second == -1)
+			{
+				messages << "Line " << commandLine[i] << ": label " << label << " is defined more than once (lines";
+				for (int line : labelLines[label])
+					messages << ' ' << line;
+				messages << ")\n";
+				error = INVALID_LABEL;
+			}
+			if (error != SUCCESS && LOAD_ERROR == SUCCESS)
+			{
+				LOAD_ERROR = error;
+				ERROR_PC = i;
+			}
+		}
+		LOAD_MESSAGES = messages.str();
+	}
+
+	// decode every command once so that the pipeline only works on DECODED_INSTRUCTION
+	void decodeCommands()
+	{
+		program.clear();
+		program.reserve(commands.size());
+		for (int i = 0; i < (int)commands.size(); ++i)
+			program.push_back(decodeInstruction(commands[i], i, registerMap, address));
+	}
+};
+
+struct MIPS_Architecture
+{
+	int REGISTERS[32] = {0}, current_PC = 0, next_Program_Counter;													// REGISTERS
+	shared_ptr<const MIPS_PROGRAM> image; // program being run, shared by the engines running it
+	const unordered_map<string, int> &registerMap, &address;
+	const vector<vector<string>> &commands;
+	const vector<DECODED_INSTRUCTION> &program;
+	static const int MAX = (1 << 20);
+	PAGED_MEMORY data; // word addressed, pages allocated on first store
+	ostream &output, &errors; // streams of this instance, cout and cerr by default
+	TRACE_WRITER trace{output}; // per cycle register and store lines
+	TIMELINE_WRITER timeline;	// stages of every command, the pipeline only
+	LATENCY_MODEL latency;	  // cycles per opcode and stage
+	FUNCTIONAL_UNITS units;	  // latency and interval of the units behind EX
+	BRANCH_PREDICTOR predictor; // beq/bne prediction in IF
+	CACHE_MODEL dcache;			// timing of the loads and stores in DM
+	CACHE_MODEL icache;			// timing of the fetches in IF
+	int FETCH_QUEUE_SIZE = 0;	// commands IF may fetch ahead of ID, at most MAX_FETCH_QUEUE
+	int LOOP_BUFFER_SIZE = 0;	// longest loop, in commands, the loop buffer holds, 0 for none
+	vector<int> commandCount;
+	// save a checkpoint to CHECKPOINT_PATH once CHECKPOINT_AT cycles (instructions for the
+	// functional engine) have run, -1 for none
+	long long CHECKPOINT_AT = -1;
+	string CHECKPOINT_PATH;
+	bool PRINT_STATISTICS = false; // printStatistics to errors once the program has finished, unless the report has them
+	bool EVENT_DRIVEN = false;	   // jump over the cycles in which the pipeline only waits
+	exit_code EXIT_CODE = SUCCESS;	// code the program ended with
+
+	// constructor to load the program in file
+	MIPS_Architecture(istream &file, ostream &output = cout, ostream &errors = cerr) : MIPS_Architecture(make_shared<const MIPS_PROGRAM>(file), output, errors) {}
+
+	// engine running a program already loaded, possibly by other engines
+	MIPS_Architecture(shared_ptr<const MIPS_PROGRAM> image, ostream &output = cout, ostream &errors = cerr)
+		: image(image), registerMap(image->registerMap), address(image->address), commands(image->commands), program(image->program), output(output), errors(errors)
+	{
+		errors << image->LOAD_MESSAGES;
+		if (image->LOAD_ERROR != SUCCESS)
+			current_PC = image->ERROR_PC;
+		commandCount.assign(commands.size(), 0);
+	}
+
+	virtual ~MIPS_Architecture() {}
+
+	// run the program to completion, implemented by the execution engines
+	virtual void executeCommandsPipelined() = 0;
+
+	// cycles simulated and commands completed so far
+	virtual long long cycleCount() = 0;
+	virtual long long instructionCount() = 0;
+
+	// engine specific counters, printed by handleExit
+	virtual void printStatistics(ostream &) {}
+
+	// counters of the run so far, in a form other tools can read
+	virtual SIMULATION_STATISTICS statistics()
+	{
+		SIMULATION_STATISTICS stats;
+		stats.cycles = cycleCount();
+		stats.instructions = instructionCount();
+		return stats;
+	}
+
+	// name stored in checkpoints, a checkpoint only restores into the engine that wrote it
+	virtual const char *engineName() = 0;
+
+	// architectural state, engines add their own after it
+	virtual void saveState(CHECKPOINT_WRITER &out)
+	{
+		out.put(REGISTERS);
+		out.put(current_PC);
+		out.putVector(commandCount);
+		vector<uint32_t> pages = data.touchedPages();
+		out.put((uint64_t)pages.size());
+		for (uint32_t number : pages)
+		{
+			out.put(number);
+			out.put(data.findPage(number)->words);
+		}
+	}
+
+	virtual bool loadState(CHECKPOINT_READER &in)
+	{
+		uint64_t pages;
+		if (!in.get(REGISTERS) || !in.get(current_PC) || !in.getVector(commandCount) || !in.get(pages))
+			return false;
+		data.clear();
+		for (uint64_t i = 0; i < pages; ++i)
+		{
+			uint32_t number;
+			const char *words;
+			if (!in.get(number) || !(words = in.skip(sizeof(PAGED_MEMORY::PAGE::words))))
+				return false;
+			memcpy(data.touchPage(number)->words, words, sizeof(PAGED_MEMORY::PAGE::words));
+		}
+		return true;
+	}
+
+	bool saveCheckpoint(const string &path)
+	{
+		CHECKPOINT_HEADER header = {};
+		memcpy(header.MAGIC, CHECKPOINT_MAGIC, sizeof(header.MAGIC));
+		header.VERSION = CHECKPOINT_VERSION;
+		strncpy(header.ENGINE, engineName(), sizeof(header.ENGINE) - 1);
+		header.PROGRAM_HASH = programHash(program);
+		CHECKPOINT_WRITER out;
+		out.put(header);
+		saveState(out);
+		header.SIZE = out.bytes.size();
+		memcpy(out.bytes.data(), &header, sizeof(header));
+
+		ofstream file(path, ios::binary);
+		file.write(out.bytes.data(), out.bytes.size());
+		return (bool)file;
+	}
+
+	// map the checkpoint at path and continue from it, false if it is missing, of another
+	// version, written by another engine or program, or truncated
+	bool restoreCheckpoint(const string &path)
+	{
+		MAPPED_FILE file(path);
+		CHECKPOINT_READER in{file.data, file.data + file.size};
+		CHECKPOINT_HEADER header;
+		if (!file.data || !in.get(header))
+			return false;
+		if (memcmp(header.MAGIC, CHECKPOINT_MAGIC, sizeof(header.MAGIC)) != 0 || header.VERSION != CHECKPOINT_VERSION || header.SIZE != file.size)
+			return false;
+		if (strncmp(header.ENGINE, engineName(), sizeof(header.ENGINE)) != 0 || header.PROGRAM_HASH != programHash(program))
+			return false;
+		if (!loadState(in) || in.p != in.end)
+			return false;
+		trace.CYCLE = cycleCount();
+		return true;
+	}
+
+	// checks if the register is a valid one
+	 bool REGISTER_CHECK(string r)
+	{
+		return registerMap.find(r) != registerMap.end();
+	}
+
+	// checks if all of the REGISTERS are valid or not
+	bool REGISTERS_CHECK(vector<string> regs)
+	{
+		return all_of(regs.begin(), regs.end(), [&](string r)
+					  { return REGISTER_CHECK(r); });
+	}
+
+	
+	void handleExit(exit_code code, int cycleCount)
+	{
+		EXIT_CODE = code;
+		trace.flush();
+		ostringstream report; // written through the trace, which may be a binary one
+		report << '\n';
+		switch (code)
+		{
+		case 1:
+			errors << "Invalid register provided or syntax error in providing register\n";
+			break;
+		case 2:
+			errors << "Label used not defined or defined too many times\n";
+			break;
+		case 3:
+			errors << "Unaligned or invalid memory address specified\n";
+			break;
+		case 4:
+			errors << "Syntax error encountered\n";
+			break;
+		case 5:
+			errors << "Memory limit exceeded\n";
+			break;
+		default:
+			break;
+		}
+		if (code != 0)
+		{
+			errors << "Error encountered at:\n";
+			for (auto &s : commands[current_PC])
+				errors << s << ' ';
+			errors << '\n';
+		}
+		report << "\nFollowing are the non-zero data values:\n";
+		for (uint32_t number : data.touchedPages())
+		{
+			const PAGED_MEMORY::PAGE *page = data.findPage(number);
+			for (int j = 0; j < PAGED_MEMORY::PAGE_WORDS; ++j)
+				if (page->words[j] != 0)
+				{
+					long long i = (long long)number << PAGED_MEMORY::PAGE_BITS | j;
+					report << 4 * i << '-' << 4 * i + 3 << hex << ": " << page->words[j] << '\n'
+						 << dec;
+				}
+		}
+		report << "\nTotal number of cycles: " << cycleCount << '\n';
+		report << "Count of INSTRUCTIONS executed:\n";
+		for (int i = 0; i < (int)commands.size(); ++i)
+		{
+			report << commandCount[i] << " times:\t";
+			for (auto &s : commands[i])
+				report << s << ' ';
+			report << '\n';
+		}
+		printStatistics(report);
+		trace.writeText(report.str());
+		trace.flush();
+	}
+
+	// print the register data in hexadecimal
+	void register_PRINT(int clockCycle)
+	{
+		// cout << "Cycle number: " << clockCycle << '\n';
+		trace.CYCLE = clockCycle;
+		trace.writeRegisters(REGISTERS);
+	}
+
+ 	// problems found while loading are reported instead of running, false if the program cannot run
+	bool programLoaded()
+	{
+		if (commands.size() >= MAX / 4)
+		{
+			handleExit(MEMORY_ERROR, 0);
+			return false;
+		}
+		if (image->LOAD_ERROR != SUCCESS)
+		{
+			handleExit(image->LOAD_ERROR, 0);
+			return false;
+		}
+		return true;
+	}
+
+};
+
+// cycle accurate 5 stage pipeline (IF, ID, EX, DM, WB), HAZARD_POLICY decides when the command in ID
+// may issue and where its operands come from, see MIPS_Hazard.hpp
+template <class HAZARD_POLICY>
+struct MIPS_Pipeline : MIPS_Architecture
+{
+	struct LATCH_BETWEEN_REGISTER
+	{
+		DECODED_INSTRUCTION com;
+		int REG_ONE = 0;
+		int VALUE_ONE = 0;
+		int REG_TWO = 0;
+		int VALUE_TWO = 0;
+		uint8_t DATA_SOURCE = FROM_REGISTER_FILE; // sw: where the store data comes from
+		uint64_t SEQ = 0;						  // sequence number in inFlight, 0 for a bubble
+		uint64_t DATA_SEQ = 0;					  // sw from MEM/WB at MEM: the lw it stores the result of
+		int PREDICTED_PC = 0;					  // beq/bne: command IF fetched after it
+		int READY_CYCLE = 0;					  // first cycle at which WB may write the result back
+	};
+	LATCH_BETWEEN_REGISTER L2, L3, L4, L5;
+	bool stall = false;
+	int stall_UNTIL_CYCLE = 0;
+	HAZARD_POLICY hazard;
+	int STAGE_BUSY[STAGES] = {0}; // cycles the command in each stage still needs there
+
+	// front end: IF fills L2, and the fetch queue behind it while L2 is taken. The loop buffer holds
+	// the commands LOOP_START to LOOP_END of the last short loop, which IF then reads without the
+	// I-cache, following a j in it at once. It only does so on the path the program takes, once no
+	// beq/bne or j ahead of IF may still send fetch elsewhere.
+	static const int MAX_FETCH_QUEUE = 8; // with the latches, fits in IN_FLIGHT_BUFFER
+	LATCH_BETWEEN_REGISTER fetchQueue[MAX_FETCH_QUEUE];
+	int FETCH_QUEUE_HEAD = 0, FETCH_QUEUE_COUNT = 0;
+	int FETCH_RESUME_CYCLE = 0; // IF is redirected, it fetches again from this cycle
+	int LOOP_START = 0, LOOP_END = -1;
+	uint64_t LOOP_BUFFER_HITS = 0, FOLDED_JUMPS = 0;
+
+	// pipeline state carried from one cycle to the next
+	int NUMBER_OF_CYCLES = 0;
+	long long SKIPPED_CYCLES = 0; // idle cycles jumped over in event driven mode
+	long long RETIRED = 0;		  // commands written back, or done in ID or IF for j
+	CPI_STACK cpi;					  // where the issue slot of every cycle went
+	uint8_t STALL_CAUSE = CPI_RAW_ALU; // what ID waits for while a hazard stalls it
+	uint8_t FETCH_CAUSE = CPI_FETCH;   // why L2 is empty, once the command in it has left
+	IN_FLIGHT_BUFFER inFlight;
+	bool storedword = false;
+	int storedaddress = 0, storedvalue = 0;
+
+	MIPS_Pipeline(istream &file, ostream &output = cout, ostream &errors = cerr) : MIPS_Architecture(file, output, errors) {}
+	MIPS_Pipeline(shared_ptr<const MIPS_PROGRAM> image, ostream &output = cout, ostream &errors = cerr) : MIPS_Architecture(image, output, errors) {}
+
+	void printStatistics(ostream &out)
+	{
+		cpi.printStatistics(out, RETIRED);
+		hazard.printStatistics(out);
+		if (units.configured())
+			units.printStatistics(out);
+		if (predictor.enabled())
+			predictor.printStatistics(out, commands);
+		if (dcache.enabled())
+			dcache.printStatistics(out, "L1 data cache");
+		if (icache.enabled())
+			icache.printStatistics(out, "L1 instruction cache");
+		if (EVENT_DRIVEN)
+			out << "Idle cycles skipped: " << SKIPPED_CYCLES << " of " << NUMBER_OF_CYCLES << '\n';
+		if (LOOP_BUFFER_SIZE > 0)
+			out << "Loop buffer: " << LOOP_BUFFER_SIZE << " commands, fetches: " << LOOP_BUFFER_HITS << ", jumps folded: " << FOLDED_JUMPS << '\n';
+	}
+
+	void executeCommandsPipelined()
+	{
+		if (!programLoaded())
+			return;
+
+		bool running = true;
+		if (CHECKPOINT_AT >= 0 && (running = runPipeline(CHECKPOINT_AT)))
+			saveCheckpoint(CHECKPOINT_PATH);
+		if (running)
+			running = runPipeline();
+		trace.flush();
+		timeline.finish(NUMBER_OF_CYCLES);
+		if (!running && EXIT_CODE == SUCCESS && trace.POLICY.KIND != TRACE_ALL)
+			handleExit(SUCCESS, NUMBER_OF_CYCLES); // the trace leaves cycles out, report how the run ended
+		else if (PRINT_STATISTICS)
+			printStatistics(errors);
+	}
+
+	// run the pipeline cycle by cycle until it drains or MAX_CYCLES cycles have been simulated,
+	// returns false once the program has finished
+	bool runPipeline(long long MAX_CYCLES = INT_MAX)
+	{
+		bool running = true;
+		while (NUMBER_OF_CYCLES < MAX_CYCLES)
+		{
+			if (EVENT_DRIVEN && skipIdleCycles(MAX_CYCLES))
+				continue;
+			if (!(running = EXECUTE_THE_PIPELINE()))
+				break;
+			latency.emulateDelay();
+		}
+		return running;
+	}
+
+	// first cycle from cycle on in which a stage may do more than count down its busy cycles, with
+	// the pipeline as it is before cycle. Up to then every cycle prints the same registers and no
+	// store. countsDown tells the stages whose busy counter runs in these cycles, waitingUnit the
+	// unit a command in EX waits for (UNIT_NONE if none).
+	int nextEventCycle(int cycle, bool countsDown[STAGES], uint8_t &waitingUnit)
+	{
+		auto live = [](const LATCH_BETWEEN_REGISTER &latch)
+		{ return latch.com.op != OP_NONE; };
+		// a stage busy for STAGE_BUSY more cycles, this one included, moves on in the last of them
+		auto busyUntil = [&](int stage)
+		{
+			countsDown[stage] = true;
+			return cycle + max(STAGE_BUSY[stage] - 1, 0);
+		};
+		fill(countsDown, countsDown + STAGES, false);
+		waitingUnit = UNIT_NONE;
+		if (inFlight.empty() && current_PC >= (int)program.size())
+			return cycle; // the pipeline has drained
+
+		int event = INT_MAX;
+		bool hold = live(L5); // WB
+		if (hold)
+			event = L5.READY_CYCLE > cycle ? L5.READY_CYCLE : busyUntil(STAGE_WB);
+		if (!hold && live(L4)) // DM
+		{
+			if (L4.DATA_SOURCE == FROM_MEM_WB_AT_MEM)
+				return cycle;
+			event = busyUntil(STAGE_MEM);
+			hold = true;
+		}
+		if (!hold && live(L3)) // EX
+		{
+			uint8_t unit = unitOf(L3.com.op);
+			if (unit != UNIT_NONE && units.units[unit].NEXT_DISPATCH > cycle)
+				event = units.units[waitingUnit = unit].NEXT_DISPATCH;
+			else
+				event = busyUntil(STAGE_EX);
+			hold = true;
+		}
+		if (!hold) // ID, L3 is a bubble
+		{
+			if (stall)
+				event = min(event, max(stall_UNTIL_CYCLE, cycle));
+			else if (live(L2))
+				return cycle;
+		}
+
+		// IF
+		bool toL2 = !stall && !hold, toQueue = !toL2 && FETCH_QUEUE_COUNT < FETCH_QUEUE_SIZE;
+		if (toL2 && FETCH_QUEUE_COUNT > 0)
+			return cycle;
+		if (toQueue && FETCH_RESUME_CYCLE > cycle)
+			event = min(event, FETCH_RESUME_CYCLE);
+		else if ((toL2 || toQueue) && current_PC < (int)program.size())
+			event = min(event, busyUntil(STAGE_IF));
+		return event == INT_MAX ? cycle : event;
+	}
+
+	// jump over the idle cycles ahead, never past MAX_CYCLES, returns false if the next cycle is not idle
+	bool skipIdleCycles(long long MAX_CYCLES)
+	{
+		bool countsDown[STAGES];
+		uint8_t waitingUnit;
+		int cycle = NUMBER_OF_CYCLES + 1;
+		long long idle = min((long long)nextEventCycle(cycle, countsDown, waitingUnit) - cycle, MAX_CYCLES - NUMBER_OF_CYCLES);
+		if (idle <= 0)
+			return false;
+		// nothing moves in these cycles, so whatever is in EX, DM or WB holds ID
+		uint8_t cause = slotCause(L3.com.op != OP_NONE || L4.com.op != OP_NONE || L5.com.op != OP_NONE, false);
+		cpi.CYCLES[cause] += idle;
+		if (timeline.enabled())
+		{
+			recordStages(NUMBER_OF_CYCLES);
+			recordFetch(inFlight.NEXT_SEQUENCE, NUMBER_OF_CYCLES);
+			timeline.slot(cause, NUMBER_OF_CYCLES);
+		}
+		for (int stage = 0; stage < STAGES; ++stage)
+			if (countsDown[stage])
+				STAGE_BUSY[stage] -= idle;
+		if (waitingUnit != UNIT_NONE)
+			units.units[waitingUnit].BUSY_CYCLES += idle;
+		trace.writeIdleCycles(REGISTERS, idle);
+		NUMBER_OF_CYCLES += idle;
+		SKIPPED_CYCLES += idle;
+		return true;
+	}
+
+	const char *engineName()
+	{
+		return HAZARD_POLICY::NAME;
+	}
+
+	long long cycleCount()
+	{
+		return NUMBER_OF_CYCLES;
+	}
+
+	long long instructionCount()
+	{
+		return RETIRED;
+	}
+
+	SIMULATION_STATISTICS statistics()
+	{
+		SIMULATION_STATISTICS stats = MIPS_Architecture::statistics();
+		stats.hasCpiStack = true;
+		stats.cpiStack = cpi;
+		long long busy = 0, waited = 0;
+		for (const FUNCTIONAL_UNITS::UNIT &unit : units.units)
+			busy += unit.BUSY_CYCLES, waited += unit.DEPENDENCY_CYCLES;
+		stats.counters = {{"branch_penalty", predictor.PENALTY_CYCLES}, {"dcache_stall", dcache.STALL_CYCLES}, {"icache_stall", icache.STALL_CYCLES}, {"unit_busy", busy}, {"unit_wait", waited}};
+		return stats;
+	}
+
+	void saveState(CHECKPOINT_WRITER &out)
+	{
+		MIPS_Architecture::saveState(out);
+		out.put(L2), out.put(L3), out.put(L4), out.put(L5);
+		out.put(stall), out.put(stall_UNTIL_CYCLE);
+		out.put(NUMBER_OF_CYCLES), out.put(SKIPPED_CYCLES), out.put(RETIRED);
+		out.put(cpi), out.put(STALL_CAUSE), out.put(FETCH_CAUSE);
+		out.put(STAGE_BUSY);
+		out.put(hazard);
+		out.put(inFlight);
+		out.put(predictor.KIND), out.put(predictor.TABLE_BITS), out.put(predictor.BTB_ENTRIES);
+		out.putVector(predictor.COUNTERS);
+		out.putVector(predictor.BTB);
+		out.put(predictor.HISTORY);
+		out.putVector(predictor.BRANCHES);
+		out.put(predictor.BTB_MISSES), out.put(predictor.PENALTY_CYCLES);
+		dcache.save(out);
+		icache.save(out);
+		out.put(units);
+		out.put(FETCH_QUEUE_SIZE), out.put(LOOP_BUFFER_SIZE);
+		out.put(fetchQueue), out.put(FETCH_QUEUE_HEAD), out.put(FETCH_QUEUE_COUNT), out.put(FETCH_RESUME_CYCLE);
+		out.put(LOOP_START), out.put(LOOP_END), out.put(LOOP_BUFFER_HITS), out.put(FOLDED_JUMPS);
+	}
+
+	bool loadState(CHECKPOINT_READER &in)
+	{
+		return MIPS_Architecture::loadState(in) && in.get(L2) && in.get(L3) && in.get(L4) && in.get(L5) &&
+			   in.get(stall) && in.get(stall_UNTIL_CYCLE) && in.get(NUMBER_OF_CYCLES) && in.get(SKIPPED_CYCLES) && in.get(RETIRED) &&
+			   in.get(cpi) && in.get(STALL_CAUSE) && in.get(FETCH_CAUSE) && in.get(STAGE_BUSY) &&
+			   in.get(hazard) && in.get(inFlight) && loadPredictor(in) && dcache.load(in) &&
+			   icache.load(in) && loadFrontEnd(in);
+	}
+
+	// the fetch queue and loop buffer only restore into ones of the same size
+	bool loadFrontEnd(CHECKPOINT_READER &in)
+	{
+		FUNCTIONAL_UNITS saved;
+		if (!in.get(saved) || !saved.sameConfiguration(units))
+			return false;
+		units = saved;
+		int fetchQueueSize, loopBufferSize;
+		if (!in.get(fetchQueueSize) || !in.get(loopBufferSize) || fetchQueueSize != FETCH_QUEUE_SIZE || loopBufferSize != LOOP_BUFFER_SIZE)
+			return false;
+		return in.get(fetchQueue) && in.get(FETCH_QUEUE_HEAD) && in.get(FETCH_QUEUE_COUNT) && in.get(FETCH_RESUME_CYCLE) &&
+			   in.get(LOOP_START) && in.get(LOOP_END) && in.get(LOOP_BUFFER_HITS) && in.get(FOLDED_JUMPS);
+	}
+
+	// the predictor state only restores into a predictor configured the same way
+	bool loadPredictor(CHECKPOINT_READER &in)
+	{
+		uint8_t kind;
+		int tableBits, btbEntries;
+		if (!in.get(kind) || !in.get(tableBits) || !in.get(btbEntries))
+			return false;
+		if (kind != predictor.KIND || (predictor.enabled() && tableBits != predictor.TABLE_BITS) || btbEntries != predictor.BTB_ENTRIES)
+			return false;
+		return in.getVector(predictor.COUNTERS) && in.getVector(predictor.BTB) && in.get(predictor.HISTORY) &&
+			   in.getVector(predictor.BRANCHES) && in.get(predictor.BTB_MISSES) && in.get(predictor.PENALTY_CYCLES);
+	}
+
+	// true while ins still needs more cycles in stage, counting this one. A stage only works
+	// while it is not held by the stage after it.
+	bool occupy(int stage, const DECODED_INSTRUCTION &ins)
+	{
+		if (STAGE_BUSY[stage] == 0)
+			STAGE_BUSY[stage] = latency.cycles(ins.op, stage);
+		return --STAGE_BUSY[stage] > 0;
+	}
+
+	// fetch restarts at a new PC in the next cycle, squashing what the fetch queue holds (L2 is
+	// left to the caller, it is older than the queue)
+	void redirectFetch()
+	{
+		STAGE_BUSY[STAGE_IF] = STAGE_BUSY[STAGE_ID] = 0;
+		for (; FETCH_QUEUE_COUNT > 0; FETCH_QUEUE_COUNT--)
+			inFlight.squash(fetchQueue[(FETCH_QUEUE_HEAD + FETCH_QUEUE_COUNT - 1) % MAX_FETCH_QUEUE].SEQ);
+		FETCH_RESUME_CYCLE = NUMBER_OF_CYCLES + 1;
+	}
+
+	// whether a beq/bne or j fetched but not yet resolved may still redirect fetch, so that what IF
+	// fetches now may be squashed
+	bool speculating() const
+	{
+		auto redirects = [](const LATCH_BETWEEN_REGISTER &latch)
+		{ return IS_BRANCH(latch.com.op) || latch.com.op == OP_J; };
+		if (redirects(L2) || redirects(L3))
+			return true;
+		for (int i = 0; i < FETCH_QUEUE_COUNT; ++i)
+			if (redirects(fetchQueue[(FETCH_QUEUE_HEAD + i) % MAX_FETCH_QUEUE]))
+				return true;
+		return false;
+	}
+
+	bool inLoopBuffer(int pc) const
+	{
+		return pc >= LOOP_START && pc <= LOOP_END;
+	}
+
+	// control goes back from pc to target, the loop buffer takes the loop if it is short enough
+	void captureLoop(int pc, int target)
+	{
+		if (target <= pc && pc - target < LOOP_BUFFER_SIZE)
+			LOOP_START = target, LOOP_END = pc;
+	}
+
+	// cycles IF spends on the command at pc on top of its latency
+	int fetchCycles(int pc)
+	{
+		if (inLoopBuffer(pc))
+		{
+			LOOP_BUFFER_HITS++;
+			return 0;
+		}
+		LOOP_END = -1; // fetch left the loop
+		return icache.access(pc * 4, false);
+	}
+
+	// ID to WB work on L2 to L5 in cycle
+	void recordStages(long long cycle)
+	{
+		timeline.occupy(STAGE_ID, L2.SEQ, L2.com.pc, cycle);
+		timeline.occupy(STAGE_EX, L3.SEQ, L3.com.pc, cycle);
+		timeline.occupy(STAGE_MEM, L4.SEQ, L4.com.pc, cycle);
+		timeline.occupy(STAGE_WB, L5.SEQ, L5.com.pc, cycle);
+	}
+
+	// IF worked in cycle on the command it fetched, which got fetchSequence, or on the one at
+	// current_PC while it needs more cycles
+	void recordFetch(uint64_t fetchSequence, long long cycle)
+	{
+		if (inFlight.NEXT_SEQUENCE != fetchSequence)
+			timeline.occupy(STAGE_IF, fetchSequence, inFlight.back().pc, cycle);
+		else if (STAGE_BUSY[STAGE_IF] > 0)
+			timeline.occupy(STAGE_IF, fetchSequence, current_PC, cycle);
+		else
+			timeline.occupy(STAGE_IF, 0, -1, cycle);
+	}
+
+	// simulate a single clock cycle, returns false once the program has finished
+	bool EXECUTE_THE_PIPELINE()
+	{
+		register_PRINT(NUMBER_OF_CYCLES);
+		long long cycle = NUMBER_OF_CYCLES;
+		if (timeline.enabled())
+			recordStages(cycle);
+		NUMBER_OF_CYCLES++;
+		storedword = false;
+		storedaddress = 0;
+		storedvalue = 0;
+
+		// each stage reports whether it holds its input latch, which holds the stages before it
+		bool hold = WRITE_BACK_STAGE();
+		hold = MEMORY_STAGE(hold);
+		hold = EXECUTE_STAGE(hold);
+		HAZARD_DETECTION_STAGE(hold);
+		bool decoding = L2.com.op != OP_NONE;
+		bool held = hold;
+		hold = DECODE_STAGE(hold);
+		uint8_t cause = slotCause(held, decoding && L2.com.op == OP_NONE);
+		cpi.CYCLES[cause]++;
+		uint64_t fetchSequence = inFlight.NEXT_SEQUENCE; // the command IF works on gets it
+		if (!FETCH_STAGE(hold))
+			return false;
+		if (timeline.enabled())
+		{
+			timeline.slot(cause, cycle);
+			recordFetch(fetchSequence, cycle);
+		}
+
+		if (inFlight.empty() && current_PC >= (int)program.size())
+		{ // cycles are completed if no commmand left to execute.
+			register_PRINT(NUMBER_OF_CYCLES);
+			if (!storedword)
+			{
+				trace.writeNoStore();
+			}
+			else
+			{
+				trace.writeStore(storedaddress, storedvalue);
+			}
+			return false;
+		}
+		return true;
+	}
+
+	// stage 5 WB: write the result in L5 back and retire the command
+	bool WRITE_BACK_STAGE()
+	{
+		if (L5.READY_CYCLE > NUMBER_OF_CYCLES)
+			return true; // its unit is still working on it
+		if (occupy(STAGE_WB, L5.com))
+			return true;
+		hazard.writeBack(L5.com);
+		if (IS_ALU(L5.com.op))
+		{
+			REGISTERS[L5.com.rd] = L5.VALUE_ONE;
+		}
+		else if (L5.com.op == OP_LW)
+		{
+			REGISTERS[L5.REG_ONE] = L5.VALUE_ONE; // loading done in DM stage.
+		}
+
+		// marks completion of commands.
+		if (inFlight.retire(L5.SEQ))
+		{
+			RETIRED++;
+			commandCount[L5.com.pc]++;
+		}
+		return false;
+	}
+
+	// stage 4 DM: move L4 to L5, performing the load or store
+	bool MEMORY_STAGE(bool hold)
+	{
+		if (!hold && L4.com.op == OP_SW && L4.DATA_SOURCE == FROM_MEM_WB_AT_MEM)
+		{
+			// MEM -> MEM while the load ahead is still in MEM/WB. A sw taking more than a cycle in EX
+			// only gets here once the load has written back.
+			L4.VALUE_ONE = L5.SEQ == L4.DATA_SEQ ? L5.VALUE_ONE : REGISTERS[L4.REG_ONE];
+			L4.DATA_SOURCE = FROM_REGISTER_FILE;
+		}
+		if (!hold && STAGE_BUSY[STAGE_MEM] == 0 && (L4.com.op == OP_LW || L4.com.op == OP_SW))
+		{ // a cache miss holds the command in DM on top of its latency
+			STAGE_BUSY[STAGE_MEM] = latency.cycles(L4.com.op, STAGE_MEM) + dcache.access(L4.com.imm + L4.VALUE_TWO, L4.com.op == OP_SW);
+		}
+		bool busy = hold || occupy(STAGE_MEM, L4.com);
+		if (busy)
+		{
+			if (!hold)
+				L5 = LATCH_BETWEEN_REGISTER(); // bubble
+		}
+		else if ((L5 = L4).com.op == OP_LW)
+		{
+			L5.VALUE_ONE = data.read((L5.com.imm + L5.VALUE_TWO) / 4); // LATCH_BETWEEN_REGISTER loads value at lw.
+		}
+		else if (L5.com.op == OP_SW)
+		{
+			storedword = true;
+			storedaddress = (L5.com.imm + L5.VALUE_TWO) / 4;
+			data.write(storedaddress, L5.VALUE_ONE); // storage done
+			storedvalue = L5.VALUE_ONE;
+			trace.writeStore(storedaddress, L5.VALUE_ONE);
+		}
+
+		if (!storedword)
+		{
+			trace.writeNoStore();
+		}
+		return busy;
+	}
+
+	// stage 3 EX: compute L3 into L4, resolving beq/bne
+	bool EXECUTE_STAGE(bool hold)
+	{
+		if (hold)
+			return true;
+		if (!units.available(L3.com.op, NUMBER_OF_CYCLES) || occupy(STAGE_EX, L3.com))
+		{
+			L4 = LATCH_BETWEEN_REGISTER(); // bubble
+			return true;
+		}
+		L4 = L3;
+		L4.READY_CYCLE = units.dispatch(L3.com, NUMBER_OF_CYCLES);
+		switch (L3.com.op)
+		{
+		case OP_ADD:
+			L4.REG_ONE = L3.com.rd;
+			L4.VALUE_ONE = L3.VALUE_ONE + L3.VALUE_TWO;
+			break;
+		case OP_SUB:
+			L4.REG_ONE = L3.com.rd;
+			L4.VALUE_ONE = L3.VALUE_ONE - L3.VALUE_TWO;
+			break;
+		case OP_MUL:
+			L4.REG_ONE = L3.com.rd;
+			L4.VALUE_ONE = L3.VALUE_ONE * L3.VALUE_TWO;
+			break;
+		case OP_SLT:
+			L4.REG_ONE = L3.com.rd;
+			L4.VALUE_ONE = L3.VALUE_ONE < L3.VALUE_TWO;
+			break;
+		case OP_BEQ:
+		case OP_BNE:
+		{ // during bypassing
+			L4.VALUE_ONE = L3.com.target;
+			bool taken = L3.com.op == OP_BEQ ? L3.VALUE_ONE == L3.VALUE_TWO : L3.VALUE_ONE != L3.VALUE_TWO;
+			int next = taken ? L3.com.target : L3.com.pc + 1;
+			if (taken)
+				captureLoop(L3.com.pc, L3.com.target);
+			if (predictor.enabled())
+			{
+				predictor.update(L3.com, taken, L3.PREDICTED_PC);
+				if (next == L3.PREDICTED_PC)
+					break; // fetch went the right way
+			}
+
+			// mispredicted, or no predictor: squash the command fetched behind the branch and
+			// fetch again from next after a cycle
+			stall = true;
+			stall_UNTIL_CYCLE = NUMBER_OF_CYCLES + 1;
+			redirectFetch();
+			predictor.PENALTY_CYCLES += 1 + inFlight.squash(L2.SEQ);
+			if (timeline.enabled())
+				timeline.flush(L3.com.pc, NUMBER_OF_CYCLES - 1);
+			current_PC = next;
+			FETCH_CAUSE = CPI_BRANCH_FLUSH;
+
+			L3 = L2 = LATCH_BETWEEN_REGISTER();
+			break;
+		}
+		case OP_ADDI:
+			L4.VALUE_ONE = L3.com.imm + L3.VALUE_ONE;
+			break;
+		default: // lw/sw carry their operands to DM, bubbles move on
+			break;
+		}
+		return false;
+	}
+
+	// stage 2 ID: hold the command in L2 until the hazard policy lets it issue. Nothing leaves ID
+	// while EX holds it, so the check waits for the first cycle it is not held.
+	void HAZARD_DETECTION_STAGE(bool hold)
+	{
+		if (hold)
+			return;
+		if (stall && stall_UNTIL_CYCLE <= NUMBER_OF_CYCLES)
+		{ // done
+			stall = false;
+		}
+		if (!stall && L2.com.op != OP_NONE)
+		{
+			// word address of a lw/sw as far as the register file knows it
+			int address = (L2.com.imm + REGISTERS[L2.com.rs]) / 4;
+			int unitReady = units.operandsReady(L2.com, NUMBER_OF_CYCLES);
+			int ready = max(hazard.readyCycle(L2.com, L4.com, address, NUMBER_OF_CYCLES), unitReady);
+			if (ready > NUMBER_OF_CYCLES)
+			{
+				stall = true;
+				stall_UNTIL_CYCLE = ready;
+				STALL_CAUSE = hazardCause(L2.com, unitReady > NUMBER_OF_CYCLES);
+			}
+		}
+	}
+
+	// what ins waits for in ID: the result of the nearest command ahead writing one of its
+	// operands, or else a result still in a unit (waitsForUnit) or, for a lw, the store ahead
+	uint8_t hazardCause(const DECODED_INSTRUCTION &ins, bool waitsForUnit) const
+	{
+		uint32_t sources = SOURCE_MASK(ins);
+		for (const LATCH_BETWEEN_REGISTER *latch : {&L3, &L4, &L5})
+			if (WRITES_REGISTER(latch->com.op) && sources >> latch->com.rd & 1)
+				return latch->com.op == OP_LW ? CPI_RAW_LOAD : CPI_RAW_ALU;
+		return ins.op == OP_LW && !waitsForUnit ? CPI_MEMORY_ORDER : CPI_RAW_ALU;
+	}
+
+	// where the issue slot of this cycle went: to the command which left ID (issued), or else to
+	// what kept ID from issuing one. held tells whether a stage after ID held it.
+	uint8_t slotCause(bool held, bool issued) const
+	{
+		if (issued)
+			return CPI_BASE;
+		if (L2.com.op == OP_NONE)
+		{
+			if (cpi.CYCLES[CPI_BASE] == 0)
+				return CPI_FILL;
+			if (current_PC >= (int)program.size() && FETCH_QUEUE_COUNT == 0)
+				return CPI_DRAIN;
+			return FETCH_CAUSE;
+		}
+		if (stall && !held)
+			return STALL_CAUSE;
+		return CPI_STRUCTURAL; // a later stage, or ID itself, takes more than a cycle
+	}
+
+	// stage 2 ID: read the operands of L2 into L3, the hazard policy picks each one from the
+	// register file or from the results of the commands ahead in L4 (EX/MEM) and L5 (MEM/WB)
+	bool DECODE_STAGE(bool hold)
+	{
+		if (hold)
+			return true;
+		if (stall || L2.com.op == OP_NONE)
+		{
+			L3 = LATCH_BETWEEN_REGISTER(); // bubble
+			return false;
+		}
+		if (occupy(STAGE_ID, L2.com))
+		{
+			L3 = LATCH_BETWEEN_REGISTER();
+			return true;
+		}
+
+		const DECODED_INSTRUCTION &ID = L2.com;
+		auto operand = [&](int r)
+		{
+			switch (hazard.select(r, L4.com, L5.com))
+			{
+			case FROM_EX_MEM:
+				return L4.VALUE_ONE;
+			case FROM_MEM_WB:
+				return L5.VALUE_ONE;
+			default:
+				return REGISTERS[r];
+			}
+		};
+
+		L3 = LATCH_BETWEEN_REGISTER();
+		L3.com = ID;
+		L3.SEQ = L2.SEQ;
+		L3.PREDICTED_PC = L2.PREDICTED_PC;
+		FETCH_CAUSE = CPI_FETCH;
+		switch (ID.op)
+		{
+		case OP_ADD:
+		case OP_SUB:
+		case OP_SLT:
+		case OP_MUL:
+		case OP_BEQ:
+		case OP_BNE:
+			L3.REG_ONE = ID.rs;
+			L3.REG_TWO = ID.rt;
+			L3.VALUE_ONE = operand(ID.rs);
+			L3.VALUE_TWO = operand(ID.rt);
+			break;
+		case OP_ADDI:
+			L3.REG_ONE = ID.rs;
+			L3.VALUE_ONE = operand(ID.rs);
+			break;
+		case OP_LW:
+			// the base register goes in VALUE_TWO
+			L3.REG_ONE = ID.rd;
+			L3.REG_TWO = ID.rs;
+			L3.VALUE_TWO = operand(ID.rs);
+			break;
+		case OP_SW:
+			// data register in VALUE_ONE, base register in VALUE_TWO
+			L3.REG_ONE = ID.rt;
+			L3.REG_TWO = ID.rs;
+			L3.VALUE_TWO = operand(ID.rs);
+			if (hazard.storeDataFromMemory(ID, L4.com))
+			{
+				L3.DATA_SOURCE = FROM_MEM_WB_AT_MEM;
+				L3.DATA_SEQ = L4.SEQ;
+			}
+			else
+				L3.VALUE_ONE = operand(ID.rt);
+			break;
+		case OP_J:
+			captureLoop(ID.pc, ID.target);
+			current_PC = ID.target;
+			redirectFetch();
+			stall = true;
+			stall_UNTIL_CYCLE = NUMBER_OF_CYCLES + 1;
+			if (inFlight.squash(L2.SEQ)) // j is done in ID
+			{
+				RETIRED++;
+				commandCount[ID.pc]++;
+			}
+			if (timeline.enabled())
+				timeline.flush(ID.pc, NUMBER_OF_CYCLES - 1);
+			FETCH_CAUSE = CPI_JUMP;
+			L3 = LATCH_BETWEEN_REGISTER();
+			break;
+		default:
+			break;
+		}
+		hazard.issue(ID, (ID.imm + L3.VALUE_TWO) / 4, NUMBER_OF_CYCLES);
+		L2 = LATCH_BETWEEN_REGISTER(); // issued, IF refills L2
+		return false;
+	}
+
+	// stage 1 IF: fetch the next command into L2 unless ID holds it, or else into the fetch queue,
+	// returns false on an invalid command
+	bool FETCH_STAGE(bool hold)
+	{
+		bool toL2 = !stall && !hold; // ID has taken L2
+		if (toL2 && FETCH_QUEUE_COUNT > 0)
+		{
+			L2 = fetchQueue[FETCH_QUEUE_HEAD];
+			FETCH_QUEUE_HEAD = (FETCH_QUEUE_HEAD + 1) % MAX_FETCH_QUEUE;
+			FETCH_QUEUE_COUNT--;
+			toL2 = false;
+		}
+		bool toQueue = !toL2 && FETCH_QUEUE_COUNT < FETCH_QUEUE_SIZE && NUMBER_OF_CYCLES >= FETCH_RESUME_CYCLE;
+		if (!toL2 && !toQueue)
+			return true;
+
+		if (current_PC < (int)program.size() && program[current_PC].op == OP_J && inLoopBuffer(current_PC) && STAGE_BUSY[STAGE_IF] == 0 && !speculating())
+		{ // the loop buffer follows the j itself, it never enters the pipeline
+			commandCount[current_PC]++;
+			current_PC = program[current_PC].target;
+			FOLDED_JUMPS++;
+			RETIRED++;
+		}
+		if (current_PC < (int)program.size())
+		{ // push new command into pipeline
+			if (program[current_PC].op == OP_INVALID)
+			{
+				handleExit(SYNTAX_ERROR, NUMBER_OF_CYCLES);
+				return false;
+			}
+			if (STAGE_BUSY[STAGE_IF] == 0)
+				STAGE_BUSY[STAGE_IF] = latency.cycles(program[current_PC].op, STAGE_IF) + fetchCycles(current_PC);
+			if (occupy(STAGE_IF, program[current_PC]))
+				return true;
+
+			LATCH_BETWEEN_REGISTER &fetched = toL2 ? L2 : fetchQueue[(FETCH_QUEUE_HEAD + FETCH_QUEUE_COUNT++) % MAX_FETCH_QUEUE];
+			fetched = LATCH_BETWEEN_REGISTER();
+			fetched.SEQ = inFlight.push(current_PC);
+			fetched.com = program[current_PC];
+			if (IS_BRANCH(fetched.com.op) && predictor.enabled())
+				current_PC = fetched.PREDICTED_PC = predictor.predict(fetched.com);
+			else
+				fetched.PREDICTED_PC = ++current_PC;
+		}
+		return true;
+	}
+
+	void clearLatches()
+	{
+		L2 = L3 = L4 = L5 = LATCH_BETWEEN_REGISTER();
+	}
+};
+
+#endif
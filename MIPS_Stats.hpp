@@ -0,0 +1,85 @@
+/**
+ * @file MIPS_Stats.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_STATS_HPP__
+#define __MIPS_STATS_HPP__
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <iomanip>
+#include <cstdint>
+
+using namespace std;
+
+// where the issue slot of a cycle went. Every cycle the pipeline either issues a command from ID
+// (base) or loses the slot to the first of these causes which applies.
+enum CPI_COMPONENT : uint8_t
+{
+	CPI_BASE = 0,	  // a command left ID
+	CPI_RAW_ALU,	  // ID waited for the result of add, sub, mul, slt or addi
+	CPI_RAW_LOAD,	  // ID waited for the result of a lw
+	CPI_MEMORY_ORDER, // a lw waited in ID behind a sw to the same address
+	CPI_BRANCH_FLUSH, // nothing to issue after a beq/bne squashed what was fetched behind it
+	CPI_JUMP,		  // nothing to issue after a j redirected fetch
+	CPI_STRUCTURAL,	  // a stage busy for more than a cycle (latency, D-cache miss, busy unit) held ID
+	CPI_FETCH,		  // nothing to issue, IF was busy (latency, I-cache miss)
+	CPI_FILL,		  // before the first command left ID
+	CPI_DRAIN,		  // after the last command left ID
+	CPI_COMPONENTS
+};
+
+static const char *const CPI_COMPONENT_NAMES[CPI_COMPONENTS] = {"base", "raw_alu", "raw_load", "memory_order", "branch_flush", "jump", "structural", "fetch", "fill", "drain"};
+
+// cycles accounted to each CPI_COMPONENT, they add up to the cycles simulated
+struct CPI_STACK
+{
+	uint64_t CYCLES[CPI_COMPONENTS] = {0};
+
+	uint64_t total() const
+	{
+		uint64_t cycles = 0;
+		for (uint64_t c : CYCLES)
+			cycles += c;
+		return cycles;
+	}
+
+	void printStatistics(ostream &out, long long instructions) const
+	{
+		auto cpi = [&](uint64_t cycles)
+		{ return instructions ? (double)cycles / instructions : 0.0; };
+		out << "CPI stack (CPI, cycles):\n"
+			<< fixed << setprecision(3);
+		for (int c = 0; c < CPI_COMPONENTS; ++c)
+			out << "  " << left << setw(14) << CPI_COMPONENT_NAMES[c] << right << setw(8) << cpi(CYCLES[c]) << setw(12) << CYCLES[c] << '\n';
+		out << "  " << left << setw(14) << "total" << right << setw(8) << cpi(total()) << setw(12) << total() << '\n'
+			<< defaultfloat;
+	}
+};
+
+inline string jsonString(const string &text)
+{
+	string quoted = "\"";
+	for (char c : text)
+		quoted += c == '"' || c == '\\' ? string("\\") + c : string(1, c);
+	return quoted + '"';
+}
+
+// what an engine reports about a run, for the tools that compare runs
+struct SIMULATION_STATISTICS
+{
+	long long cycles = 0, instructions = 0;
+	bool hasCpiStack = false; // only the pipeline accounts its cycles
+	CPI_STACK cpiStack;
+	vector<pair<string, long long>> counters; // other counters of the engine, by name
+
+	double cpi() const
+	{
+		return instructions ? (double)cycles / instructions : 0.0;
+	}
+};
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * @file MIPS_Sweep.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_SWEEP_HPP__
+#define __MIPS_SWEEP_HPP__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <ostream>
+#include <iomanip>
+#include "MIPS_Batch.hpp"
+
+using namespace std;
+
+// one dimension of a parameter sweep: a simulator option and the values it takes
+struct SWEEP_AXIS
+{
+	string option;
+	vector<string> values;
+
+	// "<option>=<value>|<value>|...", e.g. "engine=stall|forward" or
+	// "dcache=size=1024,ways=2|size=4096,ways=4", false unless every value is one the option takes
+	bool parse(const string &spec)
+	{
+		size_t equal = spec.find('=');
+		if (equal == string::npos || equal == 0)
+			return false;
+		option = spec.substr(0, equal);
+		if (option == "checkpoint" || option == "checkpoint-at" || option == "restore")
+			return false;
+		values.clear();
+		size_t begin = equal + 1;
+		while (begin <= spec.size())
+		{
+			size_t end = spec.find('|', begin);
+			if (end == string::npos)
+				end = spec.size();
+			values.push_back(spec.substr(begin, end - begin));
+			SIMULATOR_OPTIONS check;
+			if (!check.set("--" + option + "=" + values.back()) || !check.wellFormed())
+				return false;
+			begin = end + 1;
+		}
+		return true;
+	}
+};
+
+// one configuration of the grid and how the program ran on it
+struct SWEEP_POINT
+{
+	vector<string> values; // value of each axis
+	SIMULATOR_OPTIONS options;
+	int exitCode = 0;
+	SIMULATION_STATISTICS stats;
+	vector<pair<string, long long>> breakdown; // cycles of the CPI stack, then the other counters
+};
+
+// cartesian product of the axes applied to base, the last axis varying fastest. Returns no points
+// if a combination of values is not a valid configuration.
+inline vector<SWEEP_POINT> sweepGrid(const SIMULATOR_OPTIONS &base, const vector<SWEEP_AXIS> &axes)
+{
+	vector<SWEEP_POINT> points(1);
+	points[0].options = base;
+	points[0].options.traceIndex.clear(); // traces are discarded, so none is written
+	points[0].options.timeline.clear();
+	points[0].options.tracePolicy.parse("none");
+	for (const SWEEP_AXIS &axis : axes)
+	{
+		vector<SWEEP_POINT> next;
+		for (const SWEEP_POINT &point : points)
+			for (const string &value : axis.values)
+			{
+				next.push_back(point);
+				next.back().values.push_back(value);
+				next.back().options.set("--" + axis.option + "=" + value);
+			}
+		points.swap(next);
+	}
+	for (const SWEEP_POINT &point : points)
+		if (!point.options.valid())
+			return {};
+	return points;
+}
+
+// run image on every point, all engines sharing the one decoded program. Traces are discarded.
+inline void runSweep(vector<SWEEP_POINT> &points, shared_ptr<const MIPS_PROGRAM> image, int threads)
+{
+	auto simulate = [&](size_t i)
+	{
+		SWEEP_POINT &point = points[i];
+		ostream discard(nullptr);
+		unique_ptr<MIPS_Architecture> mips(point.options.create(image, discard, discard));
+		mips->executeCommandsPipelined();
+		point.exitCode = mips->EXIT_CODE;
+		point.stats = mips->statistics();
+		if (point.stats.hasCpiStack)
+			for (int c = 0; c < CPI_COMPONENTS; ++c)
+				point.breakdown.push_back({CPI_COMPONENT_NAMES[c], point.stats.cpiStack.CYCLES[c]});
+		point.breakdown.insert(point.breakdown.end(), point.stats.counters.begin(), point.stats.counters.end());
+	};
+	WORK_STEALING_POOL::run(points.size(), threads, simulate);
+}
+
+// names in the breakdown of any point, in the order they first appear
+inline vector<string> breakdownNames(const vector<SWEEP_POINT> &points)
+{
+	vector<string> names;
+	for (const SWEEP_POINT &point : points)
+		for (auto &entry : point.breakdown)
+			if (find(names.begin(), names.end(), entry.first) == names.end())
+				names.push_back(entry.first);
+	return names;
+}
+
+inline const long long *findBreakdown(const SWEEP_POINT &point, const string &name)
+{
+	for (auto &entry : point.breakdown)
+		if (entry.first == name)
+			return &entry.second;
+	return nullptr;
+}
+
+inline string csvField(const string &field)
+{
+	if (field.find_first_of(",\"\n") == string::npos)
+		return field;
+	string quoted = "\"";
+	for (char c : field)
+		quoted += c == '"' ? string("\"\"") : string(1, c);
+	return quoted + '"';
+}
+
+// one row per point: the axis values, status, cycles, instructions, CPI and the breakdown, empty
+// where the engine does not count an entry
+inline void printSweepCSV(ostream &out, const vector<SWEEP_AXIS> &axes, const vector<SWEEP_POINT> &points)
+{
+	vector<string> names = breakdownNames(points);
+	for (const SWEEP_AXIS &axis : axes)
+		out << csvField(axis.option) << ',';
+	out << "status,cycles,instructions,cpi";
+	for (const string &name : names)
+		out << ',' << name;
+	out << '\n';
+	for (const SWEEP_POINT &point : points)
+	{
+		for (const string &value : point.values)
+			out << csvField(value) << ',';
+		out << EXIT_CODE_NAMES[point.exitCode] << ',' << point.stats.cycles << ',' << point.stats.instructions << ','
+			<< fixed << setprecision(4) << point.stats.cpi() << defaultfloat;
+		for (const string &name : names)
+		{
+			out << ',';
+			if (const long long *value = findBreakdown(point, name))
+				out << *value;
+		}
+		out << '\n';
+	}
+}
+
+// an array with an object per point, with the CPI stack and counters the engine has
+inline void printSweepJSON(ostream &out, const vector<SWEEP_AXIS> &axes, const vector<SWEEP_POINT> &points)
+{
+	out << "[\n";
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		const SWEEP_POINT &point = points[i];
+		out << "  {";
+		for (size_t a = 0; a < axes.size(); ++a)
+			out << jsonString(axes[a].option) << ": " << jsonString(point.values[a]) << ", ";
+		out << "\"status\": " << jsonString(EXIT_CODE_NAMES[point.exitCode]) << ", \"cycles\": " << point.stats.cycles
+			<< ", \"instructions\": " << point.stats.instructions << ", \"cpi\": " << fixed << setprecision(4)
+			<< point.stats.cpi() << defaultfloat;
+		if (point.stats.hasCpiStack)
+		{
+			out << ", \"cpi_stack\": {";
+			for (int c = 0; c < CPI_COMPONENTS; ++c)
+				out << (c ? ", " : "") << jsonString(CPI_COMPONENT_NAMES[c]) << ": " << point.stats.cpiStack.CYCLES[c];
+			out << '}';
+		}
+		out << ", \"counters\": {";
+		for (size_t c = 0; c < point.stats.counters.size(); ++c)
+			out << (c ? ", " : "") << jsonString(point.stats.counters[c].first) << ": " << point.stats.counters[c].second;
+		out << "}}" << (i + 1 < points.size() ? "," : "") << '\n';
+	}
+	out << "]\n";
+}
+
+#endif
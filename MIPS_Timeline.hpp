@@ -0,0 +1,161 @@
+/**
+ * @file MIPS_Timeline.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_TIMELINE_HPP__
+#define __MIPS_TIMELINE_HPP__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <ostream>
+#include <fstream>
+#include <cstdint>
+#include "MIPS_Latency.hpp"
+#include "MIPS_Stats.hpp"
+
+using namespace std;
+
+// pipeline timeline in the Chrome trace event format, which Perfetto and about:tracing open. One
+// cycle is one microsecond of the timeline, cycle n starting at n as the trace lines count them.
+//   tracks IF, ID, EX, MEM, WB    a complete event per stay of a command in the stage, named after
+//                                 the command, with its sequence number and index in args
+//   track stalls                  a complete event per run of cycles whose issue slot went to the
+//                                 same CPI_COMPONENT other than base, and an instant event for every
+//                                 flush by a beq/bne or j
+// Events are written as the pipeline leaves them behind, so only the stay open in each stage is
+// kept, however long the run.
+struct TIMELINE_WRITER
+{
+	static const int STALL_TRACK = STAGES;
+
+	struct STAY
+	{
+		uint64_t seq = 0; // 0 while the stage is empty
+		int pc = -1;
+		long long begin = 0;
+	};
+
+	unique_ptr<ostream> out; // none when there is no timeline
+	const vector<vector<string>> *commands = nullptr;
+	STAY stays[STAGES];
+	uint8_t STALL_CAUSE = CPI_BASE; // of the open run of stall cycles
+	long long STALL_BEGIN = 0;
+	bool FIRST_EVENT = true;
+
+	~TIMELINE_WRITER()
+	{
+		finish(-1);
+	}
+
+	bool enabled() const
+	{
+		return (bool)out;
+	}
+
+	// write the timeline of the run of the program commands to path, false if it cannot be opened
+	bool open(const string &path, const vector<vector<string>> &program)
+	{
+		out.reset(new ofstream(path));
+		commands = &program;
+		if (!*out)
+		{
+			out.reset();
+			return false;
+		}
+		*out << "{\"traceEvents\":[";
+		for (int track = 0; track <= STALL_TRACK; ++track)
+		{
+			beginEvent("M", track);
+			*out << ",\"name\":\"thread_name\",\"args\":{\"name\":\"" << (track == STALL_TRACK ? "stalls" : STAGE_NAMES[track]) << "\"}}";
+			beginEvent("M", track);
+			*out << ",\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":" << track << "}}";
+		}
+		return true;
+	}
+
+	// the command seq at index pc is in stage in cycle, seq 0 for none
+	void occupy(int stage, uint64_t seq, int pc, long long cycle)
+	{
+		STAY &stay = stays[stage];
+		if (stay.seq == seq && stay.pc == pc)
+			return;
+		leave(stage, cycle);
+		stay = {seq, pc, cycle};
+	}
+
+	// the issue slot of cycle went to cause
+	void slot(uint8_t cause, long long cycle)
+	{
+		if (cause == STALL_CAUSE)
+			return;
+		endStall(cycle);
+		STALL_CAUSE = cause;
+		STALL_BEGIN = cycle;
+	}
+
+	// the beq/bne or j at pc squashed what was fetched behind it in cycle
+	void flush(int pc, long long cycle)
+	{
+		beginEvent("i", STALL_TRACK);
+		*out << ",\"ts\":" << cycle << ",\"s\":\"t\",\"name\":\"flush\",\"args\":{\"by\":" << jsonString(commandText(pc)) << ",\"pc\":" << pc << "}}";
+	}
+
+	// close what is open at the end of the run, in cycle, and the file
+	void finish(long long cycle)
+	{
+		if (!out)
+			return;
+		if (cycle >= 0)
+		{
+			for (int stage = 0; stage < STAGES; ++stage)
+				leave(stage, cycle);
+			endStall(cycle);
+		}
+		*out << "\n]}\n";
+		out.reset();
+	}
+
+	void leave(int stage, long long cycle)
+	{
+		STAY &stay = stays[stage];
+		if (stay.seq != 0 && cycle > stay.begin)
+		{
+			beginEvent("X", stage);
+			*out << ",\"ts\":" << stay.begin << ",\"dur\":" << cycle - stay.begin << ",\"name\":" << jsonString(commandText(stay.pc))
+				 << ",\"args\":{\"seq\":" << stay.seq << ",\"pc\":" << stay.pc << "}}";
+		}
+		stay = STAY();
+	}
+
+	void endStall(long long cycle)
+	{
+		if (STALL_CAUSE != CPI_BASE && cycle > STALL_BEGIN)
+		{
+			beginEvent("X", STALL_TRACK);
+			*out << ",\"ts\":" << STALL_BEGIN << ",\"dur\":" << cycle - STALL_BEGIN << ",\"name\":\"" << CPI_COMPONENT_NAMES[STALL_CAUSE] << "\"}";
+		}
+		STALL_CAUSE = CPI_BASE;
+	}
+
+	// "{<phase, process and track>", the caller adds the rest of the event
+	void beginEvent(const char *phase, int track)
+	{
+		*out << (FIRST_EVENT ? "\n" : ",\n") << "{\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << track;
+		FIRST_EVENT = false;
+	}
+
+	string commandText(int pc) const
+	{
+		string text;
+		if (pc >= 0 && pc < (int)commands->size())
+			for (const string &s : (*commands)[pc])
+				if (!s.empty())
+					text += (text.empty() ? "" : " ") + s;
+		return text;
+	}
+};
+
+#endif
@@ -0,0 +1,765 @@
+/**
+ * @file MIPS_Trace.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_TRACE_HPP__
+#define __MIPS_TRACE_HPP__
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+using namespace std;
+
+// per cycle output of the pipeline, in the format of Outputs/*.out:
+//   the 32 registers, each followed by a space
+//   "0" or "1 <word address> <value>" for the store done in the cycle
+// lines are formatted with to_chars into a large buffer which only goes to out when it is full
+// or on flush(), so the trace costs no flush per cycle
+//
+// With BINARY set the same lines are written as records instead, after an 8 byte header: a tag
+// byte and its operands as LEB128 varints, signed ones zigzag encoded. Only what changed is kept:
+//   K <32 registers>              registers line, a keyframe holding every register
+//   D <mask> <delta>...           registers line, the registers in mask changed by delta since the last one
+//   0                             "0" line
+//   S <address delta> <value>     "1 <address> <value>" line, the address relative to the last store
+//   I <n>                         n more cycles of the last registers line and a "0" line
+//   T <length> <bytes>            text written as it is (the report at the end of a run)
+// A K or D tag with NO_STORE set is followed by a "0" line. The first registers line, and one every
+// KEYFRAME_INTERVAL lines after it, is a keyframe. decodeTrace gives the text trace back.
+//
+// With an async sink (startAsyncTrace) full buffers go to the sink instead of out, and flush()
+// waits until the sink has written everything handed to it.
+//
+// POLICY picks the cycles whose lines are written, the others cost one branch on the policy for
+// the registers line and one on SKIPPING for the store line. With policy final the lines of the
+// last cycle are held and written on flush().
+//
+// A binary trace may also write an index to INDEX: an 8 byte header, then one TRACE_INDEX_ENTRY
+// per keyframe. queryTrace seeks to the last keyframe at or before a cycle and decodes at most
+// KEYFRAME_INTERVAL registers lines from there.
+
+enum TRACE_POLICY_KIND : uint8_t
+{
+	TRACE_ALL = 0, // every cycle
+	TRACE_NONE,	   // no cycle, only the text at the end of the run
+	TRACE_FINAL,   // the last cycle
+	TRACE_EVERY,   // cycles which are multiples of EVERY
+	TRACE_WINDOW,  // cycles BEGIN to END
+	TRACE_POLICY_KINDS
+};
+
+static const char *const TRACE_POLICY_NAMES[TRACE_POLICY_KINDS] = {"all", "none", "final", "every", "window"};
+
+struct TRACE_POLICY
+{
+	uint8_t KIND = TRACE_ALL;
+	uint64_t EVERY = 1;
+	uint64_t BEGIN = 0, END = 0; // both included
+
+	// "all", "none", "final", "every:<n>" or "window:<first>-<last>", returns false on a
+	// malformed spec
+	bool parse(const string &spec)
+	{
+		size_t colon = spec.find(':');
+		string name = spec.substr(0, colon);
+		int kind = 0;
+		while (kind < TRACE_POLICY_KINDS && name != TRACE_POLICY_NAMES[kind])
+			++kind;
+		if (kind == TRACE_POLICY_KINDS || (colon != string::npos) != (kind == TRACE_EVERY || kind == TRACE_WINDOW))
+			return false;
+		try
+		{
+			string argument = colon == string::npos ? "" : spec.substr(colon + 1);
+			size_t dash = argument.find('-');
+			if (kind == TRACE_EVERY && (argument.find_first_not_of("0123456789") != string::npos || (EVERY = stoull(argument)) == 0))
+				return false;
+			if (kind == TRACE_WINDOW && (dash == string::npos || argument.find_first_not_of("0123456789-") != string::npos ||
+										 (BEGIN = stoull(argument.substr(0, dash))) > (END = stoull(argument.substr(dash + 1)))))
+				return false;
+		}
+		catch (exception &e)
+		{
+			return false;
+		}
+		KIND = kind;
+		return true;
+	}
+
+	// how many of the cycles first .. first + count - 1 have their lines written
+	uint64_t sampled(uint64_t first, uint64_t count) const
+	{
+		if (count == 0)
+			return 0;
+		uint64_t last = first + count - 1;
+		switch (KIND)
+		{
+		case TRACE_ALL:
+			return count;
+		case TRACE_EVERY:
+			return last / EVERY - (first + EVERY - 1) / EVERY + 1;
+		case TRACE_WINDOW:
+			return max(first, BEGIN) <= min(last, END) ? min(last, END) - max(first, BEGIN) + 1 : 0;
+		default:
+			return 0;
+		}
+	}
+};
+
+// a keyframe of a binary trace, with what else the records after it are relative to
+struct TRACE_INDEX_ENTRY
+{
+	uint64_t CYCLE;	 // registers lines before the keyframe, the cycle it was written in
+	uint64_t OFFSET; // bytes of the trace before the keyframe
+	int32_t STORE;	 // address of the last store before it
+	int32_t UNUSED;
+};
+
+// where a TRACE_WRITER hands its buffers in place of its stream
+struct TRACE_SINK
+{
+	virtual ~TRACE_SINK() {}
+	virtual void push(const char *bytes, size_t size) = 0;
+	virtual void drain() = 0; // returns once everything pushed is written and flushed
+};
+
+struct TRACE_WRITER
+{
+	static const size_t BUFFER_SIZE = 1 << 16;
+	static const size_t MAX_LINE = 32 * 12 + 1; // longest line: 32 registers of 11 characters and a space
+	static constexpr char MAGIC[8] = {'M', 'I', 'P', 'S', 'T', 'R', 'C', 1};
+	static const uint8_t NO_STORE = 0x80;
+	static const uint64_t KEYFRAME_INTERVAL = 4096;
+	static constexpr char INDEX_MAGIC[8] = {'M', 'I', 'P', 'S', 'I', 'D', 'X', 1};
+
+	ostream &out;
+	char buffer[BUFFER_SIZE];
+	size_t size = 0;
+
+	// binary trace
+	bool BINARY = false;
+	bool HEADER_WRITTEN = false;
+	int LAST_REGISTERS[32] = {0}; // registers of the last registers line
+	int LAST_STORE = 0;			  // address of the last store line
+	uint64_t LINES_TO_KEYFRAME = 0; // registers lines before the next keyframe, 0 when it is the next one
+	size_t REGISTERS_TAG = SIZE_MAX; // position in buffer of the tag of the last record, if a registers line
+	uint64_t WRITTEN = 0; // bytes handed on from buffer
+	unique_ptr<ostream> INDEX; // where keyframes are indexed, none for no index
+	bool INDEX_HEADER_WRITTEN = false;
+
+	unique_ptr<TRACE_SINK> async; // writer thread taking the buffers, none to write them to out here
+
+	TRACE_POLICY POLICY;
+	uint64_t CYCLE = 0;	   // cycle of the next registers line, set to the cycle a restored run goes on from
+	bool SKIPPING = false; // the lines of the current cycle are left out
+
+	// policy final: the lines of the last cycle
+	bool HELD = false;
+	int HELD_REGISTERS[32];
+	char HELD_STORE = 0; // 0 for no store line, '0' or 'S'
+	int HELD_ADDRESS = 0, HELD_VALUE = 0;
+
+	TRACE_WRITER(ostream &out) : out(out) {}
+
+	~TRACE_WRITER()
+	{
+		flush();
+		async.reset();
+	}
+
+	// the engines flush at the end of a run, after the lines of its last cycle
+	void flush()
+	{
+		if (HELD)
+		{
+			HELD = false;
+			writeRegistersLine(HELD_REGISTERS);
+			if (HELD_STORE == 'S')
+				writeStoreLine(HELD_ADDRESS, HELD_VALUE);
+			else if (HELD_STORE == '0')
+				writeNoStoreLine();
+		}
+		if (size > 0)
+			emptyBuffer();
+		if (async)
+			async->drain();
+		if (INDEX)
+			INDEX->flush();
+	}
+
+	// hand the buffer on, to out or to the async sink
+	void emptyBuffer()
+	{
+		if (async)
+			async->push(buffer, size);
+		else
+		{
+			out.write(buffer, size);
+			out.flush();
+		}
+		WRITTEN += size;
+		size = 0;
+		REGISTERS_TAG = SIZE_MAX;
+	}
+
+	void writeInt(int value)
+	{
+		size = to_chars(buffer + size, buffer + BUFFER_SIZE, value).ptr - buffer;
+	}
+
+	void writeRegisters(const int *REGISTERS)
+	{
+		if (POLICY.KIND != TRACE_ALL && (SKIPPING = POLICY.sampled(CYCLE, 1) == 0))
+			hold(REGISTERS, 0);
+		else
+			writeRegistersLine(REGISTERS);
+		CYCLE++;
+	}
+
+	void writeStore(int address, int value)
+	{
+		if (!SKIPPING)
+			return writeStoreLine(address, value);
+		HELD_STORE = 'S';
+		HELD_ADDRESS = address;
+		HELD_VALUE = value;
+	}
+
+	void writeNoStore()
+	{
+		if (!SKIPPING)
+			return writeNoStoreLine();
+		HELD_STORE = '0';
+	}
+
+	// cycles cycles which leave REGISTERS as they are and store nothing
+	void writeIdleCycles(const int *REGISTERS, long long cycles)
+	{
+		if (cycles <= 0)
+			return;
+		uint64_t lines = cycles;
+		if (POLICY.KIND != TRACE_ALL)
+		{
+			lines = POLICY.sampled(CYCLE, cycles);
+			hold(REGISTERS, '0');
+			SKIPPING = false;
+		}
+		writeIdleLines(REGISTERS, lines);
+		CYCLE += cycles;
+	}
+
+	// keep the lines of a cycle left out for policy final
+	void hold(const int *REGISTERS, char store)
+	{
+		if (POLICY.KIND != TRACE_FINAL)
+			return;
+		memcpy(HELD_REGISTERS, REGISTERS, sizeof(HELD_REGISTERS));
+		HELD = true;
+		HELD_STORE = store;
+	}
+
+	void writeRegistersLine(const int *REGISTERS)
+	{
+		if (BINARY)
+			return writeRegistersRecord(REGISTERS);
+		if (size + MAX_LINE > BUFFER_SIZE)
+			emptyBuffer();
+		for (int i = 0; i < 32; ++i)
+		{
+			writeInt(REGISTERS[i]);
+			buffer[size++] = ' ';
+		}
+		buffer[size++] = '\n';
+	}
+
+	void writeStoreLine(int address, int value)
+	{
+		if (BINARY)
+		{
+			beginRecord('S');
+			writeSigned(address - LAST_STORE);
+			writeSigned(value);
+			LAST_STORE = address;
+			return;
+		}
+		if (size + MAX_LINE > BUFFER_SIZE)
+			emptyBuffer();
+		memcpy(buffer + size, "1 ", 2);
+		size += 2;
+		writeInt(address);
+		buffer[size++] = ' ';
+		writeInt(value);
+		buffer[size++] = '\n';
+	}
+
+	void writeNoStoreLine()
+	{
+		if (BINARY && REGISTERS_TAG != SIZE_MAX)
+		{
+			buffer[REGISTERS_TAG] |= NO_STORE;
+			REGISTERS_TAG = SIZE_MAX;
+			return;
+		}
+		if (BINARY)
+			return beginRecord('0');
+		if (size + MAX_LINE > BUFFER_SIZE)
+			emptyBuffer();
+		memcpy(buffer + size, "0\n", 2);
+		size += 2;
+	}
+
+	// lines of count cycles which leave REGISTERS as they are and store nothing: they are
+	// formatted once and copied
+	void writeIdleLines(const int *REGISTERS, uint64_t count)
+	{
+		if (count == 0)
+			return;
+		if (BINARY)
+		{
+			writeRegistersLine(REGISTERS);
+			writeNoStoreLine();
+			if (count > 1)
+			{
+				beginRecord('I');
+				writeVarint(count - 1);
+				LINES_TO_KEYFRAME -= min<uint64_t>(LINES_TO_KEYFRAME, count - 1);
+			}
+			return;
+		}
+		if (BUFFER_SIZE - size < 2 * MAX_LINE)
+			emptyBuffer(); // the first two lines must not be flushed apart
+		size_t begin = size;
+		writeRegistersLine(REGISTERS);
+		writeNoStoreLine();
+		size_t length = size - begin;
+		char lines[MAX_LINE + 2];
+		memcpy(lines, buffer + begin, length);
+		for (uint64_t i = 1; i < count; ++i)
+		{
+			if (size + length > BUFFER_SIZE)
+				emptyBuffer();
+			memcpy(buffer + size, lines, length);
+			size += length;
+		}
+	}
+
+	// text which is not a trace line, such as the report at the end of a run
+	void writeText(const string &text)
+	{
+		if (BINARY)
+		{
+			beginRecord('T');
+			writeVarint(text.size());
+		}
+		for (size_t at = 0; at < text.size();)
+		{
+			if (size == BUFFER_SIZE)
+				emptyBuffer();
+			size_t part = min(BUFFER_SIZE - size, text.size() - at);
+			memcpy(buffer + size, text.data() + at, part);
+			size += part;
+			at += part;
+		}
+	}
+
+	void writeVarint(uint64_t value)
+	{
+		for (; value >= 0x80; value >>= 7)
+			buffer[size++] = (char)(value | 0x80);
+		buffer[size++] = (char)value;
+	}
+
+	void writeSigned(int value)
+	{
+		writeVarint((uint32_t)value << 1 ^ (uint32_t)(value >> 31));
+	}
+
+	// room for a record, the header before the first one
+	void beginRecord(char tag)
+	{
+		if (size + MAX_LINE > BUFFER_SIZE)
+			emptyBuffer();
+		if (!HEADER_WRITTEN)
+		{
+			memcpy(buffer + size, MAGIC, sizeof(MAGIC));
+			size += sizeof(MAGIC);
+			HEADER_WRITTEN = true;
+		}
+		REGISTERS_TAG = SIZE_MAX;
+		buffer[size++] = tag;
+	}
+
+	void writeRegistersRecord(const int *REGISTERS)
+	{
+		bool keyframe = LINES_TO_KEYFRAME == 0;
+		uint32_t mask = 0;
+		for (int i = 0; i < 32; ++i)
+			mask |= (uint32_t)(keyframe || REGISTERS[i] != LAST_REGISTERS[i]) << i;
+		beginRecord(keyframe ? 'K' : 'D');
+		size_t tag = size - 1;
+		if (keyframe && INDEX)
+			writeIndexEntry(tag);
+		if (!keyframe)
+			writeVarint(mask);
+		for (int i = 0; i < 32; ++i)
+			if (mask >> i & 1)
+			{
+				writeSigned(keyframe ? REGISTERS[i] : (int)((uint32_t)REGISTERS[i] - (uint32_t)LAST_REGISTERS[i]));
+				LAST_REGISTERS[i] = REGISTERS[i];
+			}
+		LINES_TO_KEYFRAME = (keyframe ? KEYFRAME_INTERVAL : LINES_TO_KEYFRAME) - 1;
+		REGISTERS_TAG = tag;
+	}
+
+	// the keyframe whose tag is at position tag in buffer
+	void writeIndexEntry(size_t tag)
+	{
+		if (!INDEX_HEADER_WRITTEN)
+		{
+			INDEX->write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+			INDEX_HEADER_WRITTEN = true;
+		}
+		TRACE_INDEX_ENTRY entry = {CYCLE, WRITTEN + tag, LAST_STORE, 0};
+		INDEX->write((const char *)&entry, sizeof(entry));
+	}
+};
+
+// reads the records of a binary trace, keeping the registers and store address they are relative to
+struct TRACE_READER
+{
+	streambuf *in;
+	bool complete = true; // false once a record was cut short
+	int REGISTERS[32] = {0}; // registers line of the last K or D record
+	int store = 0;			 // address of the last S record
+	int value = 0;			 // value of the last S record
+	uint64_t repeats = 0;	 // cycles of the last I record
+	string text;			 // bytes of the last T record
+
+	TRACE_READER(istream &file) : in(file.rdbuf()) {}
+
+	uint64_t varint()
+	{
+		uint64_t value = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			int c = in->sbumpc();
+			if (c == EOF)
+			{
+				complete = false;
+				return 0;
+			}
+			value |= (uint64_t)(c & 0x7f) << shift;
+			if (!(c & 0x80))
+				break;
+		}
+		return value;
+	}
+
+	int signedVarint()
+	{
+		uint32_t value = varint();
+		return (int)(value >> 1 ^ -(value & 1));
+	}
+
+	// read the next record into the fields above, returns its tag with NO_STORE, EOF at the end of
+	// the trace and 0 for a record which is not one or is cut short
+	int next()
+	{
+		int tag = in->sbumpc();
+		if (tag == EOF)
+			return EOF;
+		switch (tag & ~TRACE_WRITER::NO_STORE)
+		{
+		case 'K':
+			for (int i = 0; i < 32; ++i)
+				REGISTERS[i] = signedVarint();
+			break;
+		case 'D':
+		{
+			uint32_t mask = varint();
+			for (int i = 0; i < 32; ++i)
+				if (mask >> i & 1)
+					REGISTERS[i] = (int)((uint32_t)REGISTERS[i] + (uint32_t)signedVarint());
+			break;
+		}
+		case '0':
+			break;
+		case 'S':
+			store += signedVarint();
+			value = signedVarint();
+			break;
+		case 'I':
+			repeats = varint();
+			break;
+		case 'T':
+		{ // read in chunks, a corrupt length then fails at the end of the trace instead of allocating it
+			uint64_t length = varint();
+			char chunk[4096];
+			text.clear();
+			while (complete && text.size() < length)
+			{
+				streamsize wanted = min<uint64_t>(sizeof(chunk), length - text.size()), got = in->sgetn(chunk, wanted);
+				text.append(chunk, got);
+				complete = got == wanted;
+			}
+			break;
+		}
+		default:
+			return 0;
+		}
+		return complete ? tag : 0;
+	}
+};
+
+inline bool readTraceHeader(istream &in)
+{
+	char magic[sizeof(TRACE_WRITER::MAGIC)];
+	return in.read(magic, sizeof(magic)) && memcmp(magic, TRACE_WRITER::MAGIC, sizeof(magic)) == 0;
+}
+
+// write the lines of the binary trace in through the text writer text, in the exact format of the
+// text trace. Returns false if in is not a binary trace or ends in the middle of a record.
+inline bool decodeTrace(istream &in, TRACE_WRITER &text)
+{
+	if (!readTraceHeader(in))
+		return false;
+	TRACE_READER reader(in);
+	for (int tag; (tag = reader.next()) != EOF;)
+	{
+		switch (tag & ~TRACE_WRITER::NO_STORE)
+		{
+		case 'K':
+		case 'D':
+			text.writeRegisters(reader.REGISTERS);
+			break;
+		case '0':
+			text.writeNoStore();
+			break;
+		case 'S':
+			text.writeStore(reader.store, reader.value);
+			break;
+		case 'I':
+			text.writeIdleCycles(reader.REGISTERS, reader.repeats);
+			break;
+		case 'T':
+			text.writeText(reader.text);
+			break;
+		default:
+			return false;
+		}
+		if (tag & TRACE_WRITER::NO_STORE)
+			text.writeNoStore();
+	}
+	text.flush();
+	return reader.complete;
+}
+
+inline bool decodeTrace(istream &in, ostream &out)
+{
+	unique_ptr<TRACE_WRITER> text(new TRACE_WRITER(out)); // its buffer is too large for the stack
+	return decodeTrace(in, *text);
+}
+
+// write the registers line and store line of cycle in the binary trace in through the text writer
+// text, finding the keyframe to decode from by a binary search of index. Returns false if in or
+// index is not a binary trace or index, or the trace has no such cycle.
+inline bool queryTrace(istream &in, istream &index, uint64_t cycle, TRACE_WRITER &text)
+{
+	char magic[sizeof(TRACE_WRITER::INDEX_MAGIC)];
+	if (!readTraceHeader(in) || !index.read(magic, sizeof(magic)) || memcmp(magic, TRACE_WRITER::INDEX_MAGIC, sizeof(magic)) != 0)
+		return false;
+	index.seekg(0, ios::end);
+	int64_t entries = ((int64_t)index.tellg() - (int64_t)sizeof(magic)) / (int64_t)sizeof(TRACE_INDEX_ENTRY);
+	TRACE_INDEX_ENTRY entry, found;
+	int64_t low = 0, high = entries - 1, at = -1; // last entry of a cycle not after cycle
+	while (low <= high)
+	{
+		int64_t middle = (low + high) / 2;
+		index.seekg(sizeof(magic) + middle * sizeof(TRACE_INDEX_ENTRY));
+		if (!index.read((char *)&entry, sizeof(entry)))
+			return false;
+		if (entry.CYCLE <= cycle)
+			at = middle, found = entry, low = middle + 1;
+		else
+			high = middle - 1;
+	}
+	if (at < 0 || !in.seekg(found.OFFSET))
+		return false;
+
+	TRACE_READER reader(in);
+	reader.store = found.STORE;
+	uint64_t line = found.CYCLE - 1; // cycle of the last registers line read
+	bool done = false;
+	for (int tag; !done && (tag = reader.next()) > 0;)
+	{
+		switch (tag & ~TRACE_WRITER::NO_STORE)
+		{
+		case 'K':
+		case 'D':
+			if (++line != cycle)
+				break;
+			text.writeRegisters(reader.REGISTERS);
+			if ((done = tag & TRACE_WRITER::NO_STORE))
+				text.writeNoStore();
+			break;
+		case '0':
+			if ((done = line == cycle))
+				text.writeNoStore();
+			break;
+		case 'S':
+			if ((done = line == cycle))
+				text.writeStore(reader.store, reader.value);
+			break;
+		case 'I':
+			if ((done = cycle <= line + reader.repeats))
+				text.writeIdleCycles(reader.REGISTERS, 1);
+			line += reader.repeats;
+			break;
+		}
+	}
+	text.flush();
+	return done;
+}
+
+// writer thread of an asynchronous trace. The simulation thread encodes binary records, which
+// cost it little, and pushes every full buffer into a lock-free single producer single consumer
+// ring, waiting only while the ring is full. The writer thread copies them to out, or formats
+// them as text, reading the ring as a streambuf so that decodeTrace does the formatting.
+struct ASYNC_TRACE : TRACE_SINK, streambuf
+{
+	static const size_t SLOTS = 16;
+
+	struct CHUNK
+	{
+		char bytes[TRACE_WRITER::BUFFER_SIZE];
+		size_t size = 0;
+		bool sync = false; // no bytes, the writer thread flushes out and acknowledges it
+	};
+
+	vector<CHUNK> ring{SLOTS};
+	alignas(64) atomic<size_t> head{0}; // next chunk the writer thread takes
+	alignas(64) atomic<size_t> tail{0}; // next chunk the simulation thread fills
+	alignas(64) atomic<uint64_t> synced{0};
+	atomic<bool> closing{false};
+	uint64_t syncs = 0;	  // sync requests pushed
+	bool reading = false; // the writer thread is reading the chunk at head
+	ostream &out;
+	bool binary;
+	TRACE_WRITER text;
+	thread worker;
+
+	ASYNC_TRACE(ostream &out, bool binary) : out(out), binary(binary), text(out)
+	{
+		worker = thread([this]
+						{ run(); });
+	}
+
+	~ASYNC_TRACE()
+	{
+		closing.store(true, memory_order_release);
+		worker.join();
+	}
+
+	// simulation thread
+	void pushChunk(const char *bytes, size_t size, bool sync)
+	{
+		size_t t = tail.load(memory_order_relaxed);
+		while (t - head.load(memory_order_acquire) == SLOTS)
+			this_thread::yield(); // back-pressure: the writer thread is behind
+		CHUNK &chunk = ring[t % SLOTS];
+		if (!sync)
+			memcpy(chunk.bytes, bytes, size);
+		chunk.size = size;
+		chunk.sync = sync;
+		tail.store(t + 1, memory_order_release);
+	}
+
+	void push(const char *bytes, size_t size)
+	{
+		pushChunk(bytes, size, false);
+	}
+
+	void drain()
+	{
+		pushChunk(nullptr, 0, true);
+		for (++syncs; synced.load(memory_order_acquire) < syncs;)
+			this_thread::yield();
+	}
+
+	// writer thread: the next chunk of bytes, end of file once the ring is empty and closing
+	int underflow()
+	{
+		size_t h = head.load(memory_order_relaxed);
+		if (reading)
+		{
+			head.store(++h, memory_order_release);
+			reading = false;
+		}
+		for (;;)
+		{
+			if (h == tail.load(memory_order_acquire))
+			{
+				if (closing.load(memory_order_acquire) && h == tail.load(memory_order_acquire))
+					return traits_type::eof();
+				this_thread::yield();
+				continue;
+			}
+			CHUNK &chunk = ring[h % SLOTS];
+			if (chunk.sync || chunk.size == 0)
+			{
+				if (chunk.sync)
+				{
+					text.flush();
+					out.flush();
+				}
+				head.store(++h, memory_order_release);
+				if (chunk.sync)
+					synced.fetch_add(1, memory_order_release);
+				continue;
+			}
+			reading = true;
+			setg(chunk.bytes, chunk.bytes, chunk.bytes + chunk.size);
+			return traits_type::to_int_type(*gptr());
+		}
+	}
+
+	void run()
+	{
+		if (!binary)
+		{
+			istream in(this);
+			decodeTrace(in, text);
+		}
+		// copy a binary trace, or skip whatever could not be decoded
+		while (underflow() != traits_type::eof())
+		{
+			if (binary)
+				out.write(gptr(), egptr() - gptr());
+			setg(eback(), egptr(), egptr());
+		}
+		text.flush();
+		out.flush();
+	}
+};
+
+// hand the buffers of trace to a writer thread from now on, trace writes binary records which
+// the thread writes out in the format trace was set to
+inline void startAsyncTrace(TRACE_WRITER &trace)
+{
+	if (trace.async)
+		return;
+	trace.async.reset(new ASYNC_TRACE(trace.out, trace.BINARY));
+	trace.BINARY = true;
+}
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file MIPS_Units.hpp
+ * @author Eklavya Agarwal
+ *
+ */
+
+#ifndef __MIPS_UNITS_HPP__
+#define __MIPS_UNITS_HPP__
+
+#include <string>
+#include <ostream>
+#include <algorithm>
+#include <cstdint>
+#include "MIPS_Instruction.hpp"
+
+using namespace std;
+
+enum FUNCTIONAL_UNIT : uint8_t
+{
+	UNIT_ALU = 0, // add, sub, slt, addi
+	UNIT_MUL,	  // mul
+	UNITS,
+	UNIT_NONE = UNITS // branches, jumps and memory commands
+};
+
+static const char *const UNIT_NAMES[UNITS] = {"alu", "mul"};
+
+inline uint8_t unitOf(uint8_t op)
+{
+	return op == OP_MUL ? UNIT_MUL : IS_ALU(op) ? UNIT_ALU
+												: UNIT_NONE;
+}
+
+// execution units behind EX. A command is dispatched to its unit when it leaves EX, and the unit
+// takes a new command INTERVAL cycles later (INTERVAL 1 is fully pipelined, INTERVAL == LATENCY
+// iterative). Its result is there LATENCY cycles after dispatch: commands reading it wait in ID
+// until then, and it is written back in order, no sooner than LATENCY cycles behind EX. Every unit
+// takes one cycle by default, as the assignment pipeline does.
+struct FUNCTIONAL_UNITS
+{
+	struct UNIT
+	{
+		int LATENCY = 1;
+		int INTERVAL = 1;
+		int NEXT_DISPATCH = 0;		   // first cycle at which the unit takes a new command
+		uint64_t DISPATCHED = 0;	   // commands executed
+		uint64_t BUSY_CYCLES = 0;	   // cycles a command waited in EX for the unit
+		uint64_t DEPENDENCY_CYCLES = 0; // cycles commands waited in ID for a result of the unit
+	};
+
+	UNIT units[UNITS];
+	int RESULT_READY[32] = {0}; // first cycle at which a reader of register r may leave ID
+	uint8_t RESULT_UNIT[32] = {0};
+
+	// one entry "<unit>:<latency>[:<interval>]", e.g. "mul:4:4" for an iterative multiplier, the
+	// unit is pipelined without an interval. Returns false on a malformed entry.
+	bool set(const string &entry)
+	{
+		size_t colon = entry.find(':');
+		if (colon == string::npos)
+			return false;
+		int unit = 0;
+		while (unit < UNITS && entry.compare(0, colon, UNIT_NAMES[unit]) != 0)
+			++unit;
+		int latency, interval;
+		try
+		{
+			size_t second = entry.find(':', colon + 1);
+			latency = stoi(entry.substr(colon + 1, second - colon - 1));
+			interval = second == string::npos ? 1 : stoi(entry.substr(second + 1));
+		}
+		catch (exception &e)
+		{
+			return false;
+		}
+		if (unit == UNITS || latency < 1 || interval < 1 || interval > latency)
+			return false;
+		units[unit].LATENCY = latency;
+		units[unit].INTERVAL = interval;
+		return true;
+	}
+
+	// comma separated list of entries for set()
+	bool parse(const string &spec)
+	{
+		return parseList(spec, *this);
+	}
+
+	// whether any unit takes more than the one cycle of the assignment pipeline
+	bool configured() const
+	{
+		for (int u = 0; u < UNITS; ++u)
+			if (units[u].LATENCY != 1 || units[u].INTERVAL != 1)
+				return true;
+		return false;
+	}
+
+	bool sameConfiguration(const FUNCTIONAL_UNITS &other) const
+	{
+		for (int u = 0; u < UNITS; ++u)
+			if (units[u].LATENCY != other.units[u].LATENCY || units[u].INTERVAL != other.units[u].INTERVAL)
+				return false;
+		return true;
+	}
+
+	// whether the unit of op takes a command in cycle, counting the cycle as busy if not
+	bool available(uint8_t op, int cycle)
+	{
+		uint8_t u = unitOf(op);
+		if (u == UNIT_NONE || units[u].NEXT_DISPATCH <= cycle)
+			return true;
+		units[u].BUSY_CYCLES++;
+		return false;
+	}
+
+	// ins leaves EX in cycle, returns the first cycle at which it may be written back
+	int dispatch(const DECODED_INSTRUCTION &ins, int cycle)
+	{
+		uint8_t u = unitOf(ins.op);
+		if (u == UNIT_NONE)
+			return 0;
+		UNIT &unit = units[u];
+		unit.NEXT_DISPATCH = cycle + unit.INTERVAL;
+		unit.DISPATCHED++;
+		if (ins.rd != 0)
+		{
+			RESULT_READY[ins.rd] = cycle + unit.LATENCY - 1;
+			RESULT_UNIT[ins.rd] = u;
+		}
+		return cycle + unit.LATENCY + 1;
+	}
+
+	// first cycle at which ins has the results of the units it reads, counting the wait against
+	// the unit it waits for
+	int operandsReady(const DECODED_INSTRUCTION &ins, int cycle)
+	{
+		uint32_t sources = SOURCE_MASK(ins);
+		int ready = cycle, r = 0;
+		for (int s = 0; s < 32; ++s)
+			if (sources >> s & 1 && RESULT_READY[s] > ready)
+				ready = RESULT_READY[s], r = s;
+		if (ready > cycle)
+			units[RESULT_UNIT[r]].DEPENDENCY_CYCLES += ready - cycle;
+		return ready;
+	}
+
+	void printStatistics(ostream &out) const
+	{
+		for (int u = 0; u < UNITS; ++u)
+			out << "Unit " << UNIT_NAMES[u] << " (latency " << units[u].LATENCY << ", interval " << units[u].INTERVAL << "): "
+				<< units[u].DISPATCHED << " commands, " << units[u].BUSY_CYCLES << " cycles busy, "
+				<< units[u].DEPENDENCY_CYCLES << " cycles waited on\n";
+	}
+};
+
+#endif
@@ -0,0 +1,15 @@
+main:
+	addi $t0, $0, 3
+	addi $t2, $0, 2
+loop:
+	addi $t1, $t1, 1
+	beq $t1, $t0, out
+	j loop
+out:
+	sw $t1, 0($0)
+count:
+	addi $t3, $t3, 1
+	lw $t4, 0($0)
+	add $t5, $t5, $t4
+	bne $t3, $t2, count
+	sw $t5, 4($0)
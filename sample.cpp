@@ -1,24 +1,91 @@
-// #include "MIPS_Processor.hpp"
-#include "submitpart1.hpp"
+#include "MIPS_Sweep.hpp"
 using namespace std;
 
 int main(int argc, char *argv[])
-{	
-	if (argc != 2)
+{
+	SIMULATOR_OPTIONS options;
+	vector<string> files;
+	string batchList, outputDirectory;
+	vector<SWEEP_AXIS> axes;
+	string format = "csv";
+	bool batch = false, sweep = false, badAxis = false;
+	int threads = thread::hardware_concurrency();
+	for (int i = 1; i < argc; ++i)
 	{
-		cerr << "Required argument: file_name\n./MIPS_interpreter <file name>\n";
+		string arg = argv[i];
+		if (arg == "--batch")
+			batch = true;
+		else if (arg.rfind("--batch-list=", 0) == 0)
+			batch = true, batchList = arg.substr(13);
+		else if (arg.rfind("--output-dir=", 0) == 0)
+			outputDirectory = arg.substr(13);
+		else if (arg == "--sweep")
+			sweep = true;
+		else if (arg.rfind("--vary=", 0) == 0)
+		{
+			axes.emplace_back();
+			badAxis |= !axes.back().parse(arg.substr(7));
+		}
+		else if (arg.rfind("--format=", 0) == 0)
+			format = arg.substr(9);
+		else if (arg.rfind("--threads=", 0) == 0)
+			threads = atoi(arg.substr(10).c_str());
+		else if (!options.set(arg))
+			files.push_back(arg);
+	}
+	bool checkpointing = options.checkpointAt >= 0 || !options.restore.empty();
+	bool sweepValid = !badAxis && (format == "csv" || format == "json") && !batch && !checkpointing;
+	if (!options.valid() || (batch ? checkpointing : files.size() != 1) || (sweep && !sweepValid))
+	{
+		cerr << "Required argument: file_name\n./MIPS_interpreter " << SIMULATOR_OPTIONS::USAGE << " [--checkpoint=<file> --checkpoint-at=<cycle>] [--restore=<file>] <file name>\n"
+			 << "./MIPS_interpreter --batch [--batch-list=<file of paths>] [--threads=<n>] [--output-dir=<directory>] " << SIMULATOR_OPTIONS::USAGE << " <file or pattern>...\n"
+			 << "./MIPS_interpreter --sweep --vary=<option>=<value>|<value>|... [--vary=...] [--format=csv|json] [--threads=<n>] " << SIMULATOR_OPTIONS::USAGE << " <file name>\n";
+		return 0;
+	}
+
+	if (batch)
+	{
+		ifstream list(batchList);
+		for (string line; getline(list, line);)
+			if (!line.empty())
+				files.push_back(line);
+		auto start = chrono::steady_clock::now();
+		vector<BATCH_RESULT> results = runBatch(expandPatterns(files), options, outputDirectory, threads);
+		printBatchSummary(cout, results, chrono::duration<double>(chrono::steady_clock::now() - start).count());
 		return 0;
 	}
-	ifstream file(argv[1]);
-	MIPS_Architecture *mips;
-	if (file.is_open())
-		mips = new MIPS_Architecture(file);
-	else
+
+	ifstream file(files[0]);
+	if (!file.is_open())
 	{
 		cerr << "File could not be opened. Terminating...\n";
 		return 0;
 	}
-	
+
+	if (sweep)
+	{
+		auto image = make_shared<const MIPS_PROGRAM>(file);
+		cerr << image->LOAD_MESSAGES;
+		vector<SWEEP_POINT> points = sweepGrid(options, axes);
+		if (points.empty())
+		{
+			cerr << "Invalid combination of swept options. Terminating...\n";
+			return 0;
+		}
+		runSweep(points, image, threads);
+		if (format == "json")
+			printSweepJSON(cout, axes, points);
+		else
+			printSweepCSV(cout, axes, points);
+		return 0;
+	}
+	MIPS_Architecture *mips = options.create(file, cout, cerr);
+	if (!options.restore.empty() && !mips->restoreCheckpoint(options.restore))
+	{
+		cerr << "Checkpoint could not be restored. Terminating...\n";
+		return 0;
+	}
+
 	mips->executeCommandsPipelined();
 	return 0;
-}
\ No newline at end of file
+}
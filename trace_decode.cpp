@@ -0,0 +1,26 @@
+#include <iostream>
+#include <fstream>
+#include "MIPS_Trace.hpp"
+using namespace std;
+
+// prints the text trace of a binary trace written with --trace-format=binary
+int main(int argc, char *argv[])
+{
+	if (argc != 2)
+	{
+		cerr << "Required argument: file_name\n./trace_decode <binary trace file>\n";
+		return 0;
+	}
+	ifstream file(argv[1], ios::binary);
+	if (!file.is_open())
+	{
+		cerr << "File could not be opened. Terminating...\n";
+		return 1;
+	}
+	if (!decodeTrace(file, cout))
+	{
+		cerr << "Not a binary trace, or one cut short. Terminating...\n";
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,29 @@
+#include <iostream>
+#include <fstream>
+#include "MIPS_Trace.hpp"
+using namespace std;
+
+// prints the registers line and store line of one cycle of a binary trace written with
+// --trace-index, decoding from the keyframe the index gives for it
+int main(int argc, char *argv[])
+{
+	if (argc != 4 || string(argv[1]).rfind("--cycle=", 0) != 0)
+	{
+		cerr << "Required arguments: cycle, file_name, index_name\n./trace_query --cycle=<cycle> <binary trace file> <trace index file>\n";
+		return 0;
+	}
+	uint64_t cycle = strtoull(argv[1] + 8, nullptr, 10);
+	ifstream file(argv[2], ios::binary), index(argv[3], ios::binary);
+	if (!file.is_open() || !index.is_open())
+	{
+		cerr << "File could not be opened. Terminating...\n";
+		return 1;
+	}
+	unique_ptr<TRACE_WRITER> text(new TRACE_WRITER(cout)); // its buffer is too large for the stack
+	if (!queryTrace(file, index, cycle, *text))
+	{
+		cerr << "Not an indexed binary trace, or no such cycle in it. Terminating...\n";
+		return 1;
+	}
+	return 0;
+}